@@ -0,0 +1,90 @@
+/*
+ * Aleta.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "Aleta.h"
+
+/*
+ * Faixas de cada modo e duracao, em ms, de um sentido da varredura em
+ * cada velocidade
+ */
+static const uint8_t faixaInicio[al_modos] = {
+	0, ALETA_MINIMO, ALETA_CENTRO, ALETA_MINIMO
+};
+static const uint8_t faixaFim[al_modos] = {
+	0, ALETA_MAXIMO, ALETA_MAXIMO, ALETA_CENTRO
+};
+static const uint16_t tempoVarredura[ALETA_VELOCIDADES] = {
+	8000, 5000, 3000
+};
+
+Aleta::Aleta(tpm_Pin pin) : servo(pin) {
+}
+
+/*
+ * Inicia o servo no contador compartilhado do TPM (20 ms por periodo)
+ */
+bool Aleta::liga(tpm_Div divisor, uint16_t modulo){
+	return servo.enable(divisor, modulo);
+}
+
+void Aleta::alternaModo(){
+	modo = (al_Modo)((modo + 1) % al_modos);
+	aplicaModo();
+}
+
+void Aleta::alternaVelocidade(){
+	velocidade = (velocidade + 1) % ALETA_VELOCIDADES;
+	aplicaModo();
+}
+
+/*
+ * Aparelho desligado: a aleta fecha e o modo e mantido para a volta
+ */
+void Aleta::fecha(){
+	if(fechada){
+		return;
+	}
+	servo.setAngle(ALETA_FECHADA);
+	fechada = true;
+}
+
+void Aleta::abre(){
+	if(!fechada){
+		return;
+	}
+	fechada = false;
+	if(modo == al_parada){
+		servo.setAngle(ALETA_CENTRO);
+	} else {
+		aplicaModo();
+	}
+}
+
+void Aleta::trataInterrupcao(){
+	if(servo.isOverflowFlagSet()){
+		servo.handleOverflow();
+	}
+}
+
+al_Modo Aleta::modoAtual(){
+	return modo;
+}
+
+/*
+ * Na parada a aleta fica onde a varredura estava; nos outros modos a
+ * tabela do servo e recalculada (uma vez por comando)
+ */
+void Aleta::aplicaModo(){
+	if(fechada){
+		return;
+	}
+	if(modo == al_parada){
+		servo.stopSweep();
+		return;
+	}
+	servo.sweep(faixaInicio[modo], faixaFim[modo], tempoVarredura[velocidade]);
+}
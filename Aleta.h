@@ -0,0 +1,62 @@
+/*
+ * Aleta.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_ALETA_H_
+#define SOURCES_ALETA_H_
+
+#include <stdint.h>
+#include "mkl_TPMServo.h"
+
+/*
+ * Modos da aleta, na ordem em que cmd_swing os alterna
+ */
+typedef enum {
+	al_parada = 0,		//para na posicao em que estava
+	al_completa,
+	al_superior,
+	al_inferior,
+	al_modos
+} al_Modo;
+
+/*
+ * Angulos da aleta (servo de 0 a 180 graus): fechada com o aparelho
+ * desligado e extremidades da varredura
+ */
+#define ALETA_FECHADA		0
+#define ALETA_MINIMO		30
+#define ALETA_CENTRO		90
+#define ALETA_MAXIMO		150
+#define ALETA_VELOCIDADES	3
+
+/*
+ * Aleta de direcionamento do ar (swing). O servo faz a varredura sozinho,
+ * a partir do estouro do TPM; os comandos apenas escolhem a faixa e a
+ * velocidade, recalculando a tabela de posicoes do servo.
+ * trataInterrupcao deve ser chamado no TPMx_IRQHandler do pino, antes do
+ * tratador que limpa a flag de estouro (tacometro).
+ */
+class Aleta {
+public:
+	Aleta(tpm_Pin pin);
+	bool liga(tpm_Div divisor, uint16_t modulo);
+	void alternaModo();
+	void alternaVelocidade();
+	void fecha();
+	void abre();
+	void trataInterrupcao();
+	al_Modo modoAtual();
+	mkl_TPMServo servo;
+
+private:
+	void aplicaModo();
+
+	al_Modo modo = al_parada;
+	uint8_t velocidade = 0;
+	bool fechada = false;
+};
+
+#endif /* SOURCES_ALETA_H_ */
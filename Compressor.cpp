@@ -0,0 +1,88 @@
+/*
+ * Compressor.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "Compressor.h"
+
+Compressor::Compressor(gpio_Pin pino) {
+	saida = mkl_GPIOPort(pino);
+	saida.setPortMode(gpio_output);
+	saida.writeBit(0);
+	liberaPartida = Relogio::agora() + COMP_MIN_DESLIGADO;
+}
+
+/*
+ * Aplica a demanda se os prazos permitirem; caso contrario, ela fica
+ * pendente ate a proxima chamada apos o prazo
+ */
+void Compressor::atualiza(bool demanda){
+	demandaAtual = demanda;
+	if(demanda && !ligadoAtual && Relogio::passou(liberaPartida)){
+		aciona(true);
+	} else if(!demanda && ligadoAtual && Relogio::passou(liberaParada)){
+		aciona(false);
+	}
+}
+
+void Compressor::para(){
+	demandaAtual = false;
+	if(ligadoAtual){
+		aciona(false);
+	}
+}
+
+bool Compressor::ligado(){
+	return ligadoAtual;
+}
+
+/*
+ * Verdadeiro se a demanda difere da saida por causa de um prazo
+ */
+bool Compressor::bloqueado(){
+	return demandaAtual != ligadoAtual;
+}
+
+/*
+ * Tempo restante, em segundos (arredondado para cima), ate a saida
+ * poder seguir a demanda; 0 sem bloqueio
+ */
+uint16_t Compressor::bloqueioSegundos(){
+	uint32_t prazo = ligadoAtual ? liberaParada : liberaPartida;
+	uint32_t restante;
+
+	if(!bloqueado() || Relogio::passou(prazo)){
+		return 0;
+	}
+	restante = prazo - Relogio::agora();
+	return (restante + COMP_TICKS_SEGUNDO - 1) / COMP_TICKS_SEGUNDO;
+}
+
+uint32_t Compressor::partidas(){
+	return totalPartidas;
+}
+
+/*
+ * Muda a saida e calcula os proximos prazos: ao ligar, o tempo minimo
+ * ligado; ao desligar, o maior entre o tempo minimo desligado e o
+ * intervalo desde a ultima partida
+ */
+void Compressor::aciona(bool liga){
+	uint32_t agora = Relogio::agora();
+	uint32_t proximaPartida;
+
+	saida.writeBit(liga);
+	ligadoAtual = liga;
+	if(liga){
+		totalPartidas++;
+		liberaParada = agora + COMP_MIN_LIGADO;
+		liberaPartida = agora + COMP_ENTRE_PARTIDAS;
+	} else {
+		proximaPartida = agora + COMP_MIN_DESLIGADO;
+		if(Relogio::passou(liberaPartida, proximaPartida)){
+			liberaPartida = proximaPartida;
+		}
+	}
+}
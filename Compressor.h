@@ -0,0 +1,70 @@
+/*
+ * Compressor.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+
+#ifndef SOURCES_COMPRESSOR_H_
+#define SOURCES_COMPRESSOR_H_
+
+#include <stdint.h>
+#include "mkl_GPIOPort.h"
+#include "Relogio.h"
+
+/*
+ * Tempos de protecao, em segundos, e convertidos para ticks do Relogio
+ * (RELOGIO_TICK_MS, o periodo programado no PIT por RELOGIO_PIT_LDVAL)
+ */
+#define COMP_MIN_LIGADO_S		180			//funcionamento apos a partida
+#define COMP_MIN_DESLIGADO_S	180			//parado (equalizacao)
+#define COMP_ENTRE_PARTIDAS_S	360			//de partida a partida
+
+#define COMP_TICKS_SEGUNDO		RELOGIO_MS(1000)
+#define COMP_MIN_LIGADO			(COMP_MIN_LIGADO_S * COMP_TICKS_SEGUNDO)
+#define COMP_MIN_DESLIGADO		(COMP_MIN_DESLIGADO_S * COMP_TICKS_SEGUNDO)
+#define COMP_ENTRE_PARTIDAS		(COMP_ENTRE_PARTIDAS_S * COMP_TICKS_SEGUNDO)
+
+static_assert(COMP_TICKS_SEGUNDO * RELOGIO_TICK_MS == 1000,
+		"tick do Relogio nao divide o segundo");
+static_assert(COMP_ENTRE_PARTIDAS_S >= COMP_MIN_LIGADO_S,
+		"intervalo entre partidas menor que o tempo minimo ligado");
+
+/*
+ * Saida do compressor com protecao contra ciclos curtos. atualiza recebe
+ * a demanda (termostato e aparelho ligado) e so muda a saida quando os
+ * prazos permitem:
+ *  - depois de partir, fica ligado ao menos COMP_MIN_LIGADO;
+ *  - depois de parar, fica desligado ao menos COMP_MIN_DESLIGADO;
+ *  - duas partidas distam ao menos COMP_ENTRE_PARTIDAS.
+ * Na inicializacao conta como recem-desligado: um reset ou queda de
+ * energia nao religa o compressor imediatamente.
+ *
+ * Os prazos sao instantes do Relogio, comparados com passou(); nada
+ * bloqueia. atualiza deve ser chamado periodicamente (alarme de
+ * atualizacao). para() desliga imediatamente, ignorando o tempo minimo
+ * ligado, para falhas (ventilador travado).
+ */
+class Compressor {
+public:
+	Compressor(gpio_Pin pino);
+	void atualiza(bool demanda);
+	void para();
+	bool ligado();
+	bool bloqueado();
+	uint16_t bloqueioSegundos();
+	uint32_t partidas();
+
+private:
+	void aciona(bool liga);
+
+	mkl_GPIOPort saida;
+	bool ligadoAtual = false;
+	bool demandaAtual = false;
+	uint32_t liberaPartida;			//instante a partir do qual pode ligar
+	uint32_t liberaParada = 0;		//instante a partir do qual pode desligar
+	uint32_t totalPartidas = 0;
+};
+
+#endif /* SOURCES_COMPRESSOR_H_ */
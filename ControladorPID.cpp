@@ -0,0 +1,199 @@
+/*
+ * ControladorPID.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "ControladorPID.h"
+
+ControladorPID::ControladorPID() {
+}
+
+/*
+ * Ganhos em Q8 de milesimos por decimo de grau; encerra uma sintonia em
+ * andamento
+ */
+void ControladorPID::ajustaGanhos(uint16_t kp, uint16_t ki, uint16_t kd){
+	this->kp = kp;
+	this->ki = ki;
+	this->kd = kd;
+	estadoAtual = pid_manual;
+}
+
+void ControladorPID::ajustaSetpoint(int16_t decimos){
+	setpointAtual = decimos;
+}
+
+/*
+ * Nova leitura do sensor (decimos de grau): devolve o duty cycle do
+ * ventilador em milesimos
+ */
+uint16_t ControladorPID::atualiza(int16_t temperatura, uint16_t base){
+	int32_t anterior = filtrada;
+	int32_t erro;
+	int32_t variacao;
+	int32_t saida;
+
+	if(!iniciado){
+		filtrada = (int32_t)temperatura << PID_ENTRADA_Q;
+		anterior = filtrada;
+		iniciado = true;
+	} else {
+		filtrada += (((int32_t)temperatura << PID_ENTRADA_Q) - filtrada) >> PID_FILTRO;
+	}
+	if(estadoAtual == pid_sintonizando){
+		return rele();
+	}
+
+	erro = filtrada - ((int32_t)setpointAtual << PID_ENTRADA_Q);
+	if(erro > PID_ERRO_MAX){
+		erro = PID_ERRO_MAX;
+	} else if(erro < -PID_ERRO_MAX){
+		erro = -PID_ERRO_MAX;
+	}
+	variacao = filtrada - anterior;
+	if(variacao > PID_ERRO_MAX){
+		variacao = PID_ERRO_MAX;
+	} else if(variacao < -PID_ERRO_MAX){
+		variacao = -PID_ERRO_MAX;
+	}
+
+	saida = ((int32_t)base << PID_SAIDA_Q) + kp * erro + kd * variacao + integral;
+	if(!(saida >= ((int32_t)PID_SAIDA_MAX << PID_SAIDA_Q) && erro > 0) &&
+			!(saida <= 0 && erro < 0)){
+		integral += ki * erro;
+		if(integral > ((int32_t)PID_SAIDA_MAX << PID_SAIDA_Q)){
+			integral = (int32_t)PID_SAIDA_MAX << PID_SAIDA_Q;
+		} else if(integral < -((int32_t)PID_SAIDA_MAX << PID_SAIDA_Q)){
+			integral = -((int32_t)PID_SAIDA_MAX << PID_SAIDA_Q);
+		}
+	}
+
+	if(saida <= 0){
+		return 0;
+	}
+	if(saida >= ((int32_t)PID_SAIDA_MAX << PID_SAIDA_Q)){
+		return PID_SAIDA_MAX;
+	}
+	return (saida + (1 << (PID_SAIDA_Q - 1))) >> PID_SAIDA_Q;
+}
+
+/*
+ * Zera o integral e o filtro (a proxima leitura reinicia a medida). Uma
+ * sintonia em curso e cancelada e os ganhos atuais sao mantidos.
+ */
+void ControladorPID::reinicia(){
+	integral = 0;
+	iniciado = false;
+	if(estadoAtual == pid_sintonizando){
+		estadoAtual = pid_manual;
+	}
+}
+
+/*
+ * Inicia a sintonia por rele em torno de base (milesimos), ajustada para
+ * que o rele caiba na faixa de saida
+ */
+void ControladorPID::iniciaSintonia(uint16_t base){
+	if(base < PID_SINTONIA_AMPLITUDE){
+		base = PID_SINTONIA_AMPLITUDE;
+	} else if(base > PID_SAIDA_MAX - PID_SINTONIA_AMPLITUDE){
+		base = PID_SAIDA_MAX - PID_SINTONIA_AMPLITUDE;
+	}
+	baseRele = base;
+	releAlto = filtrada > ((int32_t)setpointAtual << PID_ENTRADA_Q);
+	amostras = 0;
+	inicioCiclo = 0;
+	ciclos = 0;
+	maximo = filtrada;
+	minimo = filtrada;
+	somaAmplitude = 0;
+	somaPeriodo = 0;
+	integral = 0;
+	estadoAtual = pid_sintonizando;
+}
+
+pid_Estado ControladorPID::estado(){
+	return estadoAtual;
+}
+
+uint16_t ControladorPID::ganhoP(){
+	return kp;
+}
+
+uint16_t ControladorPID::ganhoI(){
+	return ki;
+}
+
+uint16_t ControladorPID::ganhoD(){
+	return kd;
+}
+
+/*
+ * Rele com histerese: mais ventilacao acima do setpoint, menos abaixo.
+ * Cada troca para o nivel alto fecha um ciclo; o primeiro e descartado
+ * (transitorio) e os seguintes somam pico a pico e periodo.
+ */
+uint16_t ControladorPID::rele(){
+	int32_t erro = filtrada - ((int32_t)setpointAtual << PID_ENTRADA_Q);
+
+	amostras++;
+	if(filtrada > maximo){
+		maximo = filtrada;
+	}
+	if(filtrada < minimo){
+		minimo = filtrada;
+	}
+	if(releAlto && erro < -PID_SINTONIA_HISTERESE){
+		releAlto = false;
+	} else if(!releAlto && erro > PID_SINTONIA_HISTERESE){
+		releAlto = true;
+		if(ciclos > 0){
+			somaAmplitude += maximo - minimo;
+			somaPeriodo += amostras - inicioCiclo;
+		}
+		ciclos++;
+		inicioCiclo = amostras;
+		maximo = filtrada;
+		minimo = filtrada;
+		if(ciclos > PID_SINTONIA_CICLOS){
+			concluiSintonia();
+			return baseRele;
+		}
+	}
+	if(amostras >= PID_SINTONIA_LIMITE){
+		estadoAtual = pid_falhou;
+		return baseRele;
+	}
+	return releAlto ? baseRele + PID_SINTONIA_AMPLITUDE :
+			baseRele - PID_SINTONIA_AMPLITUDE;
+}
+
+/*
+ * Ziegler-Nichols a partir do ciclo limite medido:
+ * Kp = 0,6 * 4d / (pi a), Ki = Kp / (Tu / 2), Kd = Kp * Tu / 8, com a
+ * (amplitude) em Q8 de decimos e Tu em amostras
+ */
+void ControladorPID::concluiSintonia(){
+	uint32_t amplitude = somaAmplitude / (2 * PID_SINTONIA_CICLOS);
+	uint32_t periodo = somaPeriodo / PID_SINTONIA_CICLOS;
+	uint32_t p;
+	uint32_t i;
+	uint32_t d;
+
+	if(amplitude == 0 || periodo == 0){
+		estadoAtual = pid_falhou;
+		return;
+	}
+	p = (uint32_t)PID_ZN_KU * PID_SINTONIA_AMPLITUDE / amplitude;
+	if(p > 0xFFFF){
+		p = 0xFFFF;
+	}
+	i = 2 * p / periodo;
+	d = p * periodo / 8;
+	kp = p;
+	ki = (i > 0xFFFF) ? 0xFFFF : i;
+	kd = (d > 0xFFFF) ? 0xFFFF : d;
+	estadoAtual = pid_sintonizado;
+}
@@ -0,0 +1,105 @@
+/*
+ * ControladorPID.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+
+#ifndef SOURCES_CONTROLADORPID_H_
+#define SOURCES_CONTROLADORPID_H_
+
+#include <stdint.h>
+
+/*
+ * Ponto fixo: temperatura filtrada e erro em Q8 de decimos de grau,
+ * ganhos em Q8 de milesimos do duty cycle por decimo de grau (por
+ * amostra, no integral e no derivativo); os produtos ficam em Q16 de
+ * milesimos. O erro e a variacao da medida sao limitados a PID_ERRO_MAX
+ * para que a soma dos termos caiba em 32 bits.
+ */
+#define PID_ENTRADA_Q			8
+#define PID_SAIDA_Q				16
+#define PID_SAIDA_MAX			1000		//milesimos (VENT_DUTY_ESCALA)
+#define PID_ERRO_MAX			(50 << PID_ENTRADA_Q)	//5 graus
+#define PID_FILTRO				2			//filtro da medida: alfa = 1/4
+
+#define PID_KP_PADRAO			2560		//10 milesimos por decimo
+#define PID_KI_PADRAO			64			//0,25 milesimo por decimo por amostra
+#define PID_KD_PADRAO			0
+
+/*
+ * Sintonia por rele: amplitude do rele em milesimos, histerese em
+ * decimos (Q8), ciclos medidos apos o primeiro e limite de amostras
+ * (2 h com o sensor a cada 2 s)
+ */
+#define PID_SINTONIA_AMPLITUDE	300
+#define PID_SINTONIA_HISTERESE	(2 << PID_ENTRADA_Q)
+#define PID_SINTONIA_CICLOS		3
+#define PID_SINTONIA_LIMITE		3600
+#define PID_ZN_KU				50066		//0,6 * 4 / pi em Q16
+
+typedef enum {
+	pid_manual = 0,		//ganhos padrao ou ajustados
+	pid_sintonizando,
+	pid_sintonizado,
+	pid_falhou			//sem oscilacao no limite de amostras
+} pid_Estado;
+
+/*
+ * PID de ponto fixo para o duty cycle do ventilador no modo automatico,
+ * chamado na taxa do sensor com a temperatura lida. A medida passa por
+ * um filtro de primeira ordem; o derivativo e sobre a medida (sem salto
+ * quando o setpoint muda) e o integral so acumula quando a saida nao
+ * esta saturada no sentido do erro (anti-windup por integracao
+ * condicional). A saida soma-se a uma base (a curva do termostato), que
+ * da o ponto de operacao; o PID corrige o erro restante.
+ *
+ * O erro e temperatura - setpoint: temperatura acima do setpoint pede
+ * mais ventilacao. atualiza nao usa divisao.
+ *
+ * iniciaSintonia substitui o PID por um rele em torno da base ate medir
+ * PID_SINTONIA_CICLOS oscilacoes; com a amplitude a e o periodo Tu, o
+ * ganho critico e Ku = 4d / (pi a) e os ganhos seguem Ziegler-Nichols
+ * (Kp = 0,6 Ku, Ti = Tu / 2, Td = Tu / 8). As divisoes ficam so nesse
+ * calculo, feito uma vez.
+ */
+class ControladorPID {
+public:
+	ControladorPID();
+	void ajustaGanhos(uint16_t kp, uint16_t ki, uint16_t kd);
+	void ajustaSetpoint(int16_t decimos);
+	uint16_t atualiza(int16_t temperatura, uint16_t base);
+	void reinicia();
+	void iniciaSintonia(uint16_t base);
+	pid_Estado estado();
+	uint16_t ganhoP();
+	uint16_t ganhoI();
+	uint16_t ganhoD();
+
+private:
+	uint16_t rele();
+	void concluiSintonia();
+
+	uint16_t kp = PID_KP_PADRAO;
+	uint16_t ki = PID_KI_PADRAO;
+	uint16_t kd = PID_KD_PADRAO;
+	int16_t setpointAtual = 240;
+	pid_Estado estadoAtual = pid_manual;
+
+	bool iniciado = false;
+	int32_t filtrada = 0;				//Q8
+	int32_t integral = 0;				//Q16
+
+	uint16_t baseRele = 0;
+	bool releAlto = false;
+	uint16_t amostras = 0;
+	uint16_t inicioCiclo = 0;
+	uint8_t ciclos = 0;
+	int32_t maximo = 0;
+	int32_t minimo = 0;
+	uint32_t somaAmplitude = 0;			//pico a pico, Q8
+	uint32_t somaPeriodo = 0;			//amostras
+};
+
+#endif /* SOURCES_CONTROLADORPID_H_ */
@@ -0,0 +1,101 @@
+/*
+ * CurvaVentilador.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_CURVAVENTILADOR_H_
+#define SOURCES_CURVAVENTILADOR_H_
+
+#include <stdint.h>
+
+/*!
+ * Curva do ventilador no modo automatico: X(delta, percentual), com
+ * delta = temperatura - setpoint em graus Celsius, em ordem crescente.
+ * Entre os pontos o percentual e interpolado linearmente; fora deles,
+ * vale o ponto da extremidade.
+ */
+#define CURVA_VENTILADOR(X) \
+	X(-2, 20) \
+	X(0, 35) \
+	X(2, 60) \
+	X(5, 100)
+
+/*!
+ * Faixa de delta tabelada (o DHT11 mede de 0 a 50 graus, em passos de 1)
+ */
+#define CURVA_DELTA_MIN		(-10)
+#define CURVA_DELTA_MAX		20
+
+#define CURVA_DELTA(delta, percentual) (delta),
+#define CURVA_PERCENTUAL(delta, percentual) (percentual),
+
+constexpr int8_t curvaDelta[] = { CURVA_VENTILADOR(CURVA_DELTA) };
+constexpr uint8_t curvaPercentual[] = { CURVA_VENTILADOR(CURVA_PERCENTUAL) };
+constexpr unsigned CURVA_PONTOS = sizeof(curvaDelta);
+
+/*!
+ * Interpolacao inteira no segmento que contem delta, avaliada pelo
+ * compilador ao gerar a tabela
+ */
+constexpr uint8_t interpolaCurva(int delta, unsigned i = 0) {
+	return (delta <= curvaDelta[0]) ? curvaPercentual[0] :
+		(i + 1 >= CURVA_PONTOS) ? curvaPercentual[CURVA_PONTOS - 1] :
+		(delta < curvaDelta[i + 1]) ?
+			(uint8_t)(curvaPercentual[i] +
+				(delta - curvaDelta[i]) *
+				(curvaPercentual[i + 1] - curvaPercentual[i]) /
+				(curvaDelta[i + 1] - curvaDelta[i])) :
+		interpolaCurva(delta, i + 1);
+}
+
+/*!
+ * Pontos em ordem crescente de delta e percentuais de 0 a 100
+ */
+constexpr bool curvaValida(unsigned i = 0) {
+	return (i >= CURVA_PONTOS) ? true :
+		(curvaPercentual[i] <= 100) &&
+		(i == 0 || curvaDelta[i] > curvaDelta[i - 1]) &&
+		curvaValida(i + 1);
+}
+static_assert(curvaValida(), "curva do ventilador invalida");
+
+/*!
+ * Tabela de CURVA_DELTA_MIN a CURVA_DELTA_MAX gerada em tempo de
+ * compilacao: a avaliacao em tempo de execucao e uma indexacao.
+ */
+template<unsigned... I> struct IndicesCurva {};
+template<unsigned N, unsigned... I>
+struct GeraIndicesCurva : GeraIndicesCurva<N - 1, N - 1, I...> {};
+template<unsigned... I>
+struct GeraIndicesCurva<0, I...> {
+	typedef IndicesCurva<I...> tipo;
+};
+
+template<typename Indices> struct TabelaCurva;
+template<unsigned... I>
+struct TabelaCurva<IndicesCurva<I...> > {
+	static const uint8_t percentual[sizeof...(I)];
+};
+template<unsigned... I>
+const uint8_t TabelaCurva<IndicesCurva<I...> >::percentual[sizeof...(I)] = {
+	interpolaCurva((int)I + CURVA_DELTA_MIN)...
+};
+
+typedef TabelaCurva<GeraIndicesCurva<
+		CURVA_DELTA_MAX - CURVA_DELTA_MIN + 1>::tipo> TabelaVentilador;
+
+/*!
+ * Percentual do ventilador para a diferenca temperatura - setpoint
+ */
+inline uint8_t percentualCurva(int delta) {
+	if(delta < CURVA_DELTA_MIN){
+		delta = CURVA_DELTA_MIN;
+	} else if(delta > CURVA_DELTA_MAX){
+		delta = CURVA_DELTA_MAX;
+	}
+	return TabelaVentilador::percentual[delta - CURVA_DELTA_MIN];
+}
+
+#endif /* SOURCES_CURVAVENTILADOR_H_ */
@@ -0,0 +1,52 @@
+/*
+ * Desumidificador.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "Desumidificador.h"
+#include "Psicrometria.h"
+
+/*
+ * Nova leitura valida: temperatura em graus e umidade em % (DHT11),
+ * setpoint em decimos de grau
+ */
+void Desumidificador::atualiza(int temperatura, uint8_t umidade, int16_t setpoint){
+	orvalhoAtual = pontoOrvalho(temperatura, umidade);
+	sensacaoAtual = sensacaoTermica(temperatura, umidade);
+
+	if(temperatura * 10 <= setpoint - SECO_TEMPERATURA_MIN ||
+			orvalhoAtual < SECO_ORVALHO_MIN ||
+			umidade <= SECO_UMIDADE_ALVO - SECO_HISTERESE / 2){
+		compressorLigado = false;
+	} else if(umidade >= SECO_UMIDADE_ALVO + SECO_HISTERESE / 2){
+		compressorLigado = true;
+	}
+}
+
+bool Desumidificador::compressor(){
+	return compressorLigado;
+}
+
+/*
+ * Duty cycle do ventilador, em milesimos
+ */
+uint16_t Desumidificador::ventilacao(){
+	return SECO_VENTILADOR;
+}
+
+/*
+ * Ponto de orvalho da ultima leitura, em decimos de grau
+ */
+int16_t Desumidificador::orvalho(){
+	return orvalhoAtual;
+}
+
+/*
+ * Sensacao termica (indice de calor) da ultima leitura, em decimos de
+ * grau
+ */
+int16_t Desumidificador::sensacao(){
+	return sensacaoAtual;
+}
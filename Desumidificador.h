@@ -0,0 +1,48 @@
+/*
+ * Desumidificador.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+
+#ifndef SOURCES_DESUMIDIFICADOR_H_
+#define SOURCES_DESUMIDIFICADOR_H_
+
+#include <stdint.h>
+
+#define SECO_UMIDADE_ALVO		55			//%
+#define SECO_HISTERESE			10			//banda total, %
+#define SECO_VENTILADOR			300			//milesimos: vazao baixa
+#define SECO_TEMPERATURA_MIN	20			//decimos abaixo do setpoint
+#define SECO_ORVALHO_MIN		100			//decimos: abaixo nao condensa
+
+/*
+ * Modo seco (desumidificacao): prioridade para a umidade, com o
+ * ventilador em vazao baixa para o ar passar mais tempo na serpentina.
+ * O compressor liga com a umidade em SECO_UMIDADE_ALVO + metade da banda
+ * e desliga em alvo - metade. Tambem desliga se a temperatura cair
+ * SECO_TEMPERATURA_MIN abaixo do setpoint (o modo nao deve esfriar o
+ * ambiente) ou se o ponto de orvalho ficar abaixo de SECO_ORVALHO_MIN,
+ * em que a serpentina ja nao condensa. Os ciclos do compressor passam
+ * pelas protecoes do Compressor.
+ *
+ * atualiza roda na taxa do sensor, com a temperatura e a umidade da
+ * mesma aquisicao; o ponto de orvalho e a sensacao termica vem das
+ * tabelas de Psicrometria.h, sem ponto flutuante nem divisao.
+ */
+class Desumidificador {
+public:
+	void atualiza(int temperatura, uint8_t umidade, int16_t setpoint);
+	bool compressor();
+	uint16_t ventilacao();
+	int16_t orvalho();
+	int16_t sensacao();
+
+private:
+	bool compressorLigado = false;
+	int16_t orvalhoAtual = 0;
+	int16_t sensacaoAtual = 0;
+};
+
+#endif /* SOURCES_DESUMIDIFICADOR_H_ */
@@ -0,0 +1,86 @@
+/*
+ * FilaEventos.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "FilaEventos.h"
+#include "Relogio.h"
+#include "MKL25Z4.h"
+
+FilaEventos::FilaEventos() {
+	escrita = 0;
+	leitura = 0;
+	descartados = 0;
+	maxima = 0;
+}
+
+/*!
+ * Marca o instante e copia o evento para a fila. Pode ser chamado de
+ * qualquer interrupcao ou do laco principal. Retorna false (e conta o
+ * evento como perdido) se a fila esta cheia.
+ */
+bool FilaEventos::publica(Evento *evento){
+	uint32_t primask = __get_PRIMASK();
+	uint8_t proxima, ocupacao;
+
+	__disable_irq();
+	proxima = (escrita + 1) & (EVENTOS_MAX - 1);
+	if(proxima == leitura){
+		descartados++;
+		__set_PRIMASK(primask);
+		return false;
+	}
+	evento->instante = Relogio::agora();
+	evento->ciclo = Relogio::ciclos();
+	fila[escrita] = *evento;
+	escrita = proxima;
+	ocupacao = (proxima - leitura) & (EVENTOS_MAX - 1);
+	if(ocupacao > maxima){
+		maxima = ocupacao;
+	}
+	__set_PRIMASK(primask);
+	return true;
+}
+
+/*!
+ * Retira o proximo evento. Retorna false se a fila esta vazia. Apenas o
+ * laco principal retira.
+ */
+bool FilaEventos::retira(Evento *evento){
+	if(leitura == escrita){
+		return false;
+	}
+	*evento = fila[leitura];
+	leitura = (leitura + 1) & (EVENTOS_MAX - 1);
+	return true;
+}
+
+/*!
+ * Dorme (WFI) ate que a fila tenha ao menos um evento
+ */
+void FilaEventos::aguarda(){
+	__disable_irq();
+	while(leitura == escrita){
+		__WFI();
+		__enable_irq();		//executa a interrupcao que acordou o nucleo
+		__disable_irq();
+	}
+	__enable_irq();
+}
+
+/*!
+ * Eventos descartados por fila cheia
+ */
+uint16_t FilaEventos::perdidos(){
+	return descartados;
+}
+
+/*!
+ * Maior numero de eventos pendentes ja observado, para dimensionar
+ * EVENTOS_MAX
+ */
+uint8_t FilaEventos::ocupacaoMaxima(){
+	return maxima;
+}
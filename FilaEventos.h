@@ -0,0 +1,93 @@
+/*
+ * FilaEventos.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_FILAEVENTOS_H_
+#define SOURCES_FILAEVENTOS_H_
+
+#include <stdint.h>
+#include "ReconhecedorGestos.h"
+#include "mkl_IRProtocol.h"
+#include "mkl_DHT11Sensor.h"
+
+#define EVENTOS_MAX			32		//potencia de 2
+
+typedef enum {
+	ev_nenhum = 0,
+	ev_gesto,			//gesto dos botoes do painel
+	ev_quadroIR,		//quadro do controle remoto
+	ev_aquisicao,		//aquisicao do DHT11 concluida
+	ev_alarme,			//temporizador periodico expirado
+	ev_tipos
+} ev_Tipo;
+
+typedef struct {
+	dht11_Exception excecao;
+	int temperatura;
+	uint8_t umidade;
+} AquisicaoDHT11;
+
+typedef struct {
+	ev_Tipo tipo;
+	uint32_t instante;		//ticks do Relogio na publicacao
+	uint32_t ciclo;			//Relogio::ciclos() na publicacao
+	union {
+		EventoGesto gesto;
+		ir_Frame quadro;
+		AquisicaoDHT11 aquisicao;
+		uint8_t alarme;
+	};
+} Evento;
+
+/*!
+ *  @class    FilaEventos
+ *
+ *  @brief    Fila unica de eventos de entrada, com marca de tempo,
+ *            publicados pelas rotinas de interrupcao e consumidos em um
+ *            unico ponto do laco principal.
+ *
+ *  @details  Capacidade fixa (EVENTOS_MAX), sem alocacao. Cada evento
+ *            recebe, ao ser publicado, o instante do Relogio e o valor do
+ *            contador de ciclos, de modo que o consumidor mede a latencia
+ *            da entrada ate a acao com Relogio::decorrido(evento.ciclo).
+ *
+ *            Varios produtores, de prioridades diferentes, podem publicar.
+ *            Como o Cortex-M0+ nao tem LDREX/STREX, a reserva da posicao
+ *            e feita com as interrupcoes mascaradas por poucos ciclos
+ *            (copia de um Evento), sem espera. O consumidor (laco
+ *            principal) e o unico que avanca a leitura e nunca mascara
+ *            interrupcoes ao retirar.
+ *
+ *            aguarda() dorme com WFI ate haver evento; a fila e testada
+ *            com as interrupcoes mascaradas, e o WFI acorda mesmo assim
+ *            com a interrupcao pendente, sem perder o evento publicado
+ *            entre o teste e o sono.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *        +fn bool publica(&evento);             //qualquer ISR
+ *        +fn void aguarda();                    //laco principal
+ *        +fn bool retira(&evento);
+ */
+class FilaEventos {
+public:
+	FilaEventos();
+
+	bool publica(Evento *evento);
+	bool retira(Evento *evento);
+	void aguarda();
+	uint16_t perdidos();
+	uint8_t ocupacaoMaxima();
+
+private:
+	Evento fila[EVENTOS_MAX];
+	volatile uint8_t escrita;
+	volatile uint8_t leitura;
+	volatile uint16_t descartados;
+	volatile uint8_t maxima;
+};
+
+#endif /* SOURCES_FILAEVENTOS_H_ */
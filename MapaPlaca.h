@@ -0,0 +1,228 @@
+/*
+ * MapaPlaca.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_MAPAPLACA_H_
+#define SOURCES_MAPAPLACA_H_
+
+#include <stdint.h>
+#include "mkl_GPIO.h"
+#include "mkl_TPM.h"
+#include "mkl_DMA.h"
+#include "mkl_PIT.h"
+
+/*!
+ * Recursos da placa: X(papel, tipo, recurso, divisor, modulo).
+ *
+ * rp_gpio  - pino em GPIO (mux ALT1), recurso gpio_Pin;
+ * rp_tpm   - pino em canal de TPM, recurso tpm_Pin (pino, canal, TPM e
+ *            alternativa do mux);
+ * rp_canal - canal de TPM sem pino (comparacao), recurso tpm_TPMx|tpm_CHx;
+ * rp_contador - apenas leitura do contador de um TPM, recurso tpm_TPMx;
+ * rp_dma   - canal do DMA, recurso dma_Channel;
+ * rp_pit   - canal do PIT, recurso PIT_ChPIT.
+ *
+ * divisor e modulo sao os do contador do TPM (0 nos demais tipos) e
+ * devem ser os mesmos que o driver pede ao mkl_TPMManager.
+ */
+#define MAPA_PLACA(X) \
+	X(pl_botaoSleep,		rp_gpio,	gpio_PTA1,			0,			0) \
+	X(pl_botaoReset,		rp_gpio,	gpio_PTA2,			0,			0) \
+	X(pl_botaoPower,		rp_gpio,	gpio_PTD4,			0,			0) \
+	X(pl_botaoVentilador,	rp_gpio,	gpio_PTA12,			0,			0) \
+	X(pl_displayDados,		rp_gpio,	gpio_PTA13,			0,			0) \
+	X(pl_displayClock,		rp_gpio,	gpio_PTD5,			0,			0) \
+	X(pl_displayLatch,		rp_gpio,	gpio_PTD0,			0,			0) \
+	X(pl_ledTemporizador,	rp_gpio,	gpio_PTB19,			0,			0) \
+	X(pl_ledLigado,			rp_gpio,	gpio_PTD1,			0,			0) \
+	X(pl_dht11Dados,		rp_gpio,	gpio_PTC1,			0,			0) \
+	X(pl_compressor,		rp_gpio,	gpio_PTC2,			0,			0) \
+	X(pl_ventilador,		rp_tpm,		tpm_PTD3,			tpm_div1,	838) \
+	X(pl_tacometro,			rp_tpm,		tpm_PTE20,			tpm_div32,	13106) \
+	X(pl_aleta,				rp_tpm,		tpm_PTE21,			tpm_div32,	13106) \
+	X(pl_dht11Tempo,		rp_contador,	tpm_TPM1,		tpm_div32,	13106) \
+	X(pl_receptorIR,		rp_tpm,		tpm_PTE22,			tpm_div128,	0xFFFF) \
+	X(pl_dmaReceptorIR,		rp_dma,		dma_Ch2,			0,			0) \
+	X(pl_tick,				rp_pit,		PIT_Ch0,			0,			0)
+
+typedef enum {
+	rp_gpio,
+	rp_tpm,
+	rp_canal,
+	rp_contador,
+	rp_dma,
+	rp_pit
+} rp_Tipo;
+
+#define PLACA_PAPEL(papel, tipo, recurso, divisor, modulo) papel,
+#define PLACA_RECURSO(papel, tipo, recurso, divisor, modulo) \
+	{ (tipo), (uint16_t)(recurso), (uint8_t)(divisor), (uint16_t)(modulo) },
+
+typedef enum {
+	MAPA_PLACA(PLACA_PAPEL)
+	pl_papeis
+} pl_Papel;
+
+struct RecursoPlaca {
+	rp_Tipo tipo;
+	uint16_t recurso;
+	uint8_t divisor;
+	uint16_t modulo;
+};
+
+constexpr RecursoPlaca mapaPlaca[] = { MAPA_PLACA(PLACA_RECURSO) };
+static_assert(sizeof(mapaPlaca) / sizeof(mapaPlaca[0]) == pl_papeis,
+		"mapa da placa incompleto");
+
+/*!
+ * Decodificacao dos recursos: pino (porta*32 + numero), alternativa do
+ * mux, canal de TPM (TPM*8 + canal)
+ */
+constexpr bool temPino(const RecursoPlaca &r) {
+	return r.tipo == rp_gpio || r.tipo == rp_tpm;
+}
+
+constexpr unsigned pinoPlaca(const RecursoPlaca &r) {
+	return (r.tipo == rp_gpio) ?
+		((r.recurso >> 8) & 0x7) * 32 + (r.recurso & 0x1F) :
+		((r.recurso >> 5) & 0x7) * 32 + (r.recurso & 0x1F);
+}
+
+constexpr unsigned muxPlaca(const RecursoPlaca &r) {
+	return (r.tipo == rp_gpio) ? 1 : (r.recurso >> 13) & 0x7;
+}
+
+constexpr bool temCanalTpm(const RecursoPlaca &r) {
+	return r.tipo == rp_tpm || r.tipo == rp_canal;
+}
+
+constexpr bool usaTpm(const RecursoPlaca &r) {
+	return temCanalTpm(r) || r.tipo == rp_contador;
+}
+
+constexpr unsigned tpmPlaca(const RecursoPlaca &r) {
+	return (r.recurso >> 11) & 0x3;
+}
+
+constexpr unsigned canalTpmPlaca(const RecursoPlaca &r) {
+	return (r.recurso >> 8) & 0x7;
+}
+
+/*!
+ * Conflitos entre dois recursos do mapa
+ */
+constexpr bool mesmoPino(const RecursoPlaca &a, const RecursoPlaca &b) {
+	return temPino(a) && temPino(b) && pinoPlaca(a) == pinoPlaca(b) &&
+		muxPlaca(a) == muxPlaca(b);
+}
+
+constexpr bool conflitoMux(const RecursoPlaca &a, const RecursoPlaca &b) {
+	return temPino(a) && temPino(b) && pinoPlaca(a) == pinoPlaca(b) &&
+		muxPlaca(a) != muxPlaca(b);
+}
+
+constexpr bool mesmoCanalTpm(const RecursoPlaca &a, const RecursoPlaca &b) {
+	return temCanalTpm(a) && temCanalTpm(b) && tpmPlaca(a) == tpmPlaca(b) &&
+		canalTpmPlaca(a) == canalTpmPlaca(b);
+}
+
+constexpr bool contadorIncompativel(const RecursoPlaca &a,
+		const RecursoPlaca &b) {
+	return usaTpm(a) && usaTpm(b) && tpmPlaca(a) == tpmPlaca(b) &&
+		(a.divisor != b.divisor || a.modulo != b.modulo);
+}
+
+constexpr bool mesmoCanal(const RecursoPlaca &a, const RecursoPlaca &b) {
+	return (a.tipo == rp_dma || a.tipo == rp_pit) && a.tipo == b.tipo &&
+		a.recurso == b.recurso;
+}
+
+/*!
+ * Verdadeiro se algum par (i < j) do mapa satisfaz o conflito
+ */
+template<bool (*Conflito)(const RecursoPlaca &, const RecursoPlaca &)>
+constexpr bool algumPar(unsigned i = 0, unsigned j = 1) {
+	return (i + 1 >= pl_papeis) ? false :
+		(j >= pl_papeis) ? algumPar<Conflito>(i + 1, i + 2) :
+		Conflito(mapaPlaca[i], mapaPlaca[j]) || algumPar<Conflito>(i, j + 1);
+}
+
+/*!
+ * Canais existentes: 6 no TPM0, 2 no TPM1 e no TPM2
+ */
+constexpr bool canaisExistem(unsigned i = 0) {
+	return (i >= pl_papeis) ? true :
+		(!temCanalTpm(mapaPlaca[i]) ||
+			canalTpmPlaca(mapaPlaca[i]) < (tpmPlaca(mapaPlaca[i]) == 0 ? 6u : 2u)) &&
+		canaisExistem(i + 1);
+}
+
+static_assert(!algumPar<mesmoPino>(), "pino alocado a dois papeis");
+static_assert(!algumPar<conflitoMux>(),
+		"conflito de mux: pino em duas alternativas");
+static_assert(!algumPar<mesmoCanalTpm>(), "canal de TPM alocado duas vezes");
+static_assert(!algumPar<contadorIncompativel>(),
+		"TPM compartilhado com prescaler ou MOD diferentes");
+static_assert(!algumPar<mesmoCanal>(), "canal de DMA ou PIT alocado duas vezes");
+static_assert(canaisExistem(), "canal inexistente no TPM");
+
+/*!
+ * Recursos de um papel para a construcao dos drivers, resolvidos pelo
+ * compilador (sem consulta ao mapa em tempo de execucao). O tipo do
+ * papel e verificado: pedir o pino de GPIO de um canal de DMA, por
+ * exemplo, nao compila.
+ */
+template<pl_Papel P>
+struct PinoGpio {
+	static_assert(mapaPlaca[P].tipo == rp_gpio, "papel nao e pino de GPIO");
+	static constexpr gpio_Pin pino = (gpio_Pin)mapaPlaca[P].recurso;
+	static constexpr gpio_Name porta =
+			(gpio_Name)(mapaPlaca[P].recurso & 0x700);
+};
+
+template<pl_Papel P>
+struct PinoTpm {
+	static_assert(mapaPlaca[P].tipo == rp_tpm, "papel nao e pino de TPM");
+	static constexpr tpm_Pin pino = (tpm_Pin)mapaPlaca[P].recurso;
+	static constexpr gpio_Name porta =
+			(gpio_Name)(((mapaPlaca[P].recurso >> 5) & 0x7) << 8);
+	static constexpr tpm_Div divisor = (tpm_Div)mapaPlaca[P].divisor;
+	static constexpr uint16_t modulo = mapaPlaca[P].modulo;
+};
+
+template<pl_Papel P>
+struct CanalTpm {
+	static_assert(temCanalTpm(mapaPlaca[P]), "papel nao e canal de TPM");
+	static constexpr tpm_TPMNumberMask tpm =
+			(tpm_TPMNumberMask)(mapaPlaca[P].recurso & (0x3 << 11));
+	static constexpr tpm_ChnMask canal =
+			(tpm_ChnMask)(mapaPlaca[P].recurso & (0x7 << 8));
+	static constexpr tpm_Div divisor = (tpm_Div)mapaPlaca[P].divisor;
+	static constexpr uint16_t modulo = mapaPlaca[P].modulo;
+};
+
+template<pl_Papel P>
+struct ContadorTpm {
+	static_assert(usaTpm(mapaPlaca[P]), "papel nao usa TPM");
+	static constexpr tpm_TPMNumberMask tpm =
+			(tpm_TPMNumberMask)(mapaPlaca[P].recurso & (0x3 << 11));
+	static constexpr tpm_Div divisor = (tpm_Div)mapaPlaca[P].divisor;
+	static constexpr uint16_t modulo = mapaPlaca[P].modulo;
+};
+
+template<pl_Papel P>
+struct CanalDma {
+	static_assert(mapaPlaca[P].tipo == rp_dma, "papel nao e canal de DMA");
+	static constexpr dma_Channel canal = (dma_Channel)mapaPlaca[P].recurso;
+};
+
+template<pl_Papel P>
+struct CanalPit {
+	static_assert(mapaPlaca[P].tipo == rp_pit, "papel nao e canal do PIT");
+	static constexpr PIT_ChPIT canal = (PIT_ChPIT)mapaPlaca[P].recurso;
+};
+
+#endif /* SOURCES_MAPAPLACA_H_ */
@@ -0,0 +1,209 @@
+/*
+ * MemoriaComandos.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "MemoriaComandos.h"
+
+/*
+ * Montagem e leitura dos campos de um registro
+ */
+static uint32_t montaRegistro(uint8_t protocolo, uint16_t endereco, uint8_t comando, uint8_t acao){
+	return ((uint32_t)(acao & 0xF) << 28) | ((uint32_t)(protocolo & 0xF) << 24)
+			| ((uint32_t)endereco << 8) | comando;
+}
+
+/*
+ * Chave do vinculo: protocolo, endereco e comando (registro sem a acao)
+ */
+static inline uint32_t chaveRegistro(uint32_t registro){
+	return registro & 0x0FFFFFFFUL;
+}
+
+/*
+ * Posicao inicial da chave na tabela (hash multiplicativo)
+ */
+static inline int inicio(uint32_t chave){
+	return (uint32_t)(chave * 2654435761UL) >> (32 - MEMORIA_BITS);
+}
+
+MemoriaComandos::MemoriaComandos(uint32_t setor) {
+	this->setor = setor;
+	livre = 0;
+	formatado = false;
+	numPendentes = 0;
+	for(int i = 0; i < MEMORIA_VINCULOS; i++){
+		chaves[i] = MEMORIA_VAZIO;
+		acoes[i] = 0;
+	}
+}
+
+/*!
+ * Le o setor da flash e monta a tabela em RAM (executado no boot)
+ */
+void MemoriaComandos::carrega(){
+	uint32_t registro;
+
+	livre = 0;
+	formatado = flash.readLongword(setor) == MEMORIA_ASSINATURA;
+	if(!formatado){
+		return;
+	}
+	for(livre = 1; livre < MEMORIA_REGISTROS; livre++){
+		registro = flash.readLongword(setor + 4*livre);
+		if(registro == FLASH_WORD_ERASED){
+			break;
+		}
+		aplica(registro);
+	}
+}
+
+/*!
+ * Retorna a acao aprendida para a tecla, ou 0 (nenhuma)
+ */
+uint8_t MemoriaComandos::busca(uint8_t protocolo, uint16_t endereco, uint8_t comando){
+	uint32_t chave = chaveRegistro(montaRegistro(protocolo, endereco, comando, 0));
+	int i = posicao(chave);
+
+	if(i >= 0 && chaves[i] == chave){
+		return acoes[i];
+	}
+	return 0;
+}
+
+/*!
+ * Associa a tecla a acao na tabela em RAM e guarda o vinculo para a
+ * proxima gravacao. A acao 0 desfaz o vinculo. Retorna false, sem
+ * alterar nada, se a tecla e nova e a tabela esta cheia.
+ */
+bool MemoriaComandos::aprende(uint8_t protocolo, uint16_t endereco, uint8_t comando, uint8_t acao){
+	uint32_t registro = montaRegistro(protocolo, endereco, comando, acao);
+
+	if(!aplica(registro)){
+		return false;
+	}
+	if(numPendentes == MEMORIA_PENDENTES){
+		grava();
+	}
+	pendente[numPendentes++] = registro;
+	return true;
+}
+
+/*!
+ * Grava os vinculos pendentes nas palavras livres do setor. O setor so e
+ * apagado (compactado) se nao estiver formatado ou nao houver espaco.
+ */
+flash_Exception MemoriaComandos::grava(){
+	flash_Exception status = flash_ok;
+	uint8_t i;
+
+	if(numPendentes == 0){
+		return flash_ok;
+	}
+	if(!formatado || livre + numPendentes > MEMORIA_REGISTROS){
+		numPendentes = 0;
+		return compacta();
+	}
+	for(i = 0; i < numPendentes && status == flash_ok; i++){
+		status = flash.programLongword(setor + 4*livre, pendente[i]);
+		livre++;
+	}
+	numPendentes = 0;
+	return status;
+}
+
+/*!
+ * Retorna o numero de vinculos ainda nao gravados
+ */
+int MemoriaComandos::pendentes(){
+	return numPendentes;
+}
+
+/*!
+ * Atualiza a tabela em RAM com um registro. Retorna false se a tecla e
+ * nova e nao ha posicao livre.
+ */
+bool MemoriaComandos::aplica(uint32_t registro){
+	uint32_t chave = chaveRegistro(registro);
+	uint8_t acao = (registro >> 28) & 0xF;
+	int i = posicao(chave);
+
+	if(i < 0){
+		return acao == 0;
+	}
+	if(acao == 0){
+		if(chaves[i] == chave){
+			remove(i);
+		}
+		return true;
+	}
+	chaves[i] = chave;
+	acoes[i] = acao;
+	return true;
+}
+
+/*!
+ * Posicao da chave na tabela, ou a primeira livre na sequencia de
+ * sondagem; -1 se a chave nao esta e a tabela esta cheia
+ */
+int MemoriaComandos::posicao(uint32_t chave){
+	int i = inicio(chave);
+
+	for(int n = 0; n < MEMORIA_VINCULOS; n++){
+		if(chaves[i] == chave || chaves[i] == MEMORIA_VAZIO){
+			return i;
+		}
+		i = (i + 1) & (MEMORIA_VINCULOS - 1);
+	}
+	return -1;
+}
+
+/*!
+ * Libera a posicao i e recua os vinculos seguintes da mesma sequencia de
+ * sondagem, para que nenhum fique depois de uma posicao livre
+ */
+void MemoriaComandos::remove(int i){
+	int j = i;
+	int k;
+
+	for(int n = 1; n < MEMORIA_VINCULOS; n++){
+		j = (j + 1) & (MEMORIA_VINCULOS - 1);
+		if(chaves[j] == MEMORIA_VAZIO){
+			break;
+		}
+		k = inicio(chaves[j]);
+		if(i <= j ? (i < k && k <= j) : (i < k || k <= j)){
+			continue;		//ja esta entre a posicao inicial e j
+		}
+		chaves[i] = chaves[j];
+		acoes[i] = acoes[j];
+		i = j;
+	}
+	chaves[i] = MEMORIA_VAZIO;
+	acoes[i] = 0;
+}
+
+/*!
+ * Apaga o setor e regrava a assinatura e os vinculos ativos da tabela
+ */
+flash_Exception MemoriaComandos::compacta(){
+	flash_Exception status;
+	int i;
+
+	status = flash.eraseSector(setor);
+	if(status == flash_ok){
+		status = flash.programLongword(setor, MEMORIA_ASSINATURA);
+	}
+	formatado = status == flash_ok;
+	livre = 1;
+	for(i = 0; i < MEMORIA_VINCULOS && status == flash_ok; i++){
+		if(chaves[i] != MEMORIA_VAZIO){
+			status = flash.programLongword(setor + 4*livre,
+					((uint32_t)acoes[i] << 28) | chaves[i]);
+			livre++;
+		}
+	}
+	return status;
+}
@@ -0,0 +1,81 @@
+/*
+ * MemoriaComandos.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_MEMORIACOMANDOS_H_
+#define SOURCES_MEMORIACOMANDOS_H_
+
+#include <stdint.h>
+#include "mkl_Flash.h"
+
+/*!
+ * Setor da flash reservado para as teclas aprendidas (ultimo setor dos
+ * 128 KB; deve ficar fora da regiao de codigo no script do linker).
+ */
+#ifndef MEMORIA_SETOR
+#define MEMORIA_SETOR			0x0001FC00UL
+#endif
+#define MEMORIA_ASSINATURA		0x41524331UL	//"ARC1"
+#define MEMORIA_REGISTROS		(FLASH_SECTOR_SIZE / 4)
+#define MEMORIA_PENDENTES		8
+#define MEMORIA_BITS			6		//tabela em RAM com 2^6 vinculos
+#define MEMORIA_VINCULOS		(1 << MEMORIA_BITS)
+#define MEMORIA_VAZIO			0xFFFFFFFFUL	//fora dos 28 bits da chave
+
+static_assert(MEMORIA_VINCULOS < MEMORIA_REGISTROS, "vinculos ativos nao cabem no setor compactado");
+
+/*!
+ *  @class    MemoriaComandos
+ *
+ *  @brief    Armazena na flash as teclas do controle remoto aprendidas e
+ *            as mantem em uma tabela de busca em RAM.
+ *
+ *  @details  Cada vinculo ocupa uma palavra de 32 bits no setor:
+ *            acao (4 bits), protocolo (4), endereco (16) e comando (8).
+ *            O setor funciona como um registro sequencial: novos vinculos
+ *            sao programados nas palavras livres e o setor so e apagado
+ *            (compactado) quando enche. Os vinculos aprendidos ficam
+ *            pendentes em RAM e sao gravados juntos por grava().
+ *            A tabela em RAM e um hash com sondagem linear, indexado
+ *            pela chave completa (protocolo, endereco e comando): a mesma
+ *            tecla de outro controle nao sobrescreve o vinculo. Cabem
+ *            MEMORIA_VINCULOS vinculos; com a tabela cheia, aprende
+ *            recusa teclas novas.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *        +fn void carrega();
+ *        +fn uint8_t busca(protocolo, endereco, comando);
+ *        +fn bool aprende(protocolo, endereco, comando, acao);
+ *        +fn flash_Exception grava();
+ */
+class MemoriaComandos {
+public:
+	MemoriaComandos(uint32_t setor = MEMORIA_SETOR);
+
+	void carrega();
+	uint8_t busca(uint8_t protocolo, uint16_t endereco, uint8_t comando);
+	bool aprende(uint8_t protocolo, uint16_t endereco, uint8_t comando, uint8_t acao);
+	flash_Exception grava();
+	int pendentes();
+
+private:
+	bool aplica(uint32_t registro);
+	int posicao(uint32_t chave);
+	void remove(int i);
+	flash_Exception compacta();
+
+	mkl_Flash flash;
+	uint32_t setor;
+	uint16_t livre;
+	bool formatado;
+	uint32_t chaves[MEMORIA_VINCULOS];
+	uint8_t acoes[MEMORIA_VINCULOS];
+	uint32_t pendente[MEMORIA_PENDENTES];
+	uint8_t numPendentes;
+};
+
+#endif /* SOURCES_MEMORIACOMANDOS_H_ */
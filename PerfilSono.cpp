@@ -0,0 +1,69 @@
+/*
+ * PerfilSono.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "PerfilSono.h"
+
+/*
+ * Comeca o perfil no primeiro ponto
+ */
+void PerfilSono::inicia(){
+	segmento = 0;
+	minuto = 0;
+	acrescimo = (int32_t)sonoAcrescimo[0] << SONO_Q;
+	teto = (int32_t)sonoTeto[0] << SONO_Q;
+	publica();
+	ativoAtual = true;
+}
+
+/*
+ * Volta ao setpoint e ao ventilador sem restricao
+ */
+void PerfilSono::encerra(){
+	ativoAtual = false;
+	acrescimoAtual = 0;
+	tetoAtual = 1000;
+}
+
+void PerfilSono::avancaMinuto(){
+	if(!ativoAtual || segmento >= SONO_PONTOS - 1){
+		return;
+	}
+	minuto++;
+	if(minuto >= sonoMinuto[segmento + 1]){
+		segmento++;		//valor exato no ponto, sem erro acumulado
+		acrescimo = (int32_t)sonoAcrescimo[segmento] << SONO_Q;
+		teto = (int32_t)sonoTeto[segmento] << SONO_Q;
+	} else {
+		acrescimo += PassosSono::acrescimo[segmento];
+		teto += PassosSono::teto[segmento];
+	}
+	publica();
+}
+
+bool PerfilSono::ativo(){
+	return ativoAtual;
+}
+
+/*
+ * Acrescimo ao setpoint, em decimos de grau (0 fora do modo sleep)
+ */
+int16_t PerfilSono::acrescimoSetpoint(){
+	return acrescimoAtual;
+}
+
+/*
+ * Teto do duty cycle do ventilador, em milesimos (1000 fora do modo
+ * sleep)
+ */
+uint16_t PerfilSono::tetoVentilador(){
+	return tetoAtual;
+}
+
+void PerfilSono::publica(){
+	acrescimoAtual = (acrescimo + (1 << (SONO_Q - 1))) >> SONO_Q;
+	tetoAtual = (teto + (1 << (SONO_Q - 1))) >> SONO_Q;
+}
@@ -0,0 +1,102 @@
+/*
+ * PerfilSono.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+
+#ifndef SOURCES_PERFILSONO_H_
+#define SOURCES_PERFILSONO_H_
+
+#include <stdint.h>
+#include "CurvaVentilador.h"
+
+/*!
+ * Perfil do modo sleep: X(minuto, acrescimo, teto), com o minuto desde a
+ * ativacao (em ordem crescente, comecando em 0), o acrescimo ao setpoint
+ * em decimos de grau e o teto do duty cycle do ventilador em milesimos.
+ * Entre os pontos os valores sao interpolados a cada minuto; apos o
+ * ultimo, mantidos.
+ */
+#define PERFIL_SONO(X) \
+	X(0,	0,		1000) \
+	X(20,	5,		850) \
+	X(45,	10,		700) \
+	X(90,	20,		550)
+
+#define SONO_Q				16
+
+#define SONO_MINUTO(minuto, acrescimo, teto) (minuto),
+#define SONO_ACRESCIMO(minuto, acrescimo, teto) (acrescimo),
+#define SONO_TETO(minuto, acrescimo, teto) (teto),
+
+constexpr uint16_t sonoMinuto[] = { PERFIL_SONO(SONO_MINUTO) };
+constexpr int16_t sonoAcrescimo[] = { PERFIL_SONO(SONO_ACRESCIMO) };
+constexpr int16_t sonoTeto[] = { PERFIL_SONO(SONO_TETO) };
+constexpr unsigned SONO_PONTOS = sizeof(sonoMinuto) / sizeof(sonoMinuto[0]);
+
+constexpr bool perfilSonoValido(unsigned i = 0) {
+	return (i >= SONO_PONTOS) ? true :
+		(sonoTeto[i] >= 0) && (sonoTeto[i] <= 1000) &&
+		(i == 0 ? sonoMinuto[0] == 0 : sonoMinuto[i] > sonoMinuto[i - 1]) &&
+		perfilSonoValido(i + 1);
+}
+static_assert(SONO_PONTOS >= 2 && perfilSonoValido(), "perfil do sleep invalido");
+
+/*!
+ * Incremento por minuto de cada segmento, em Q16, calculado pelo
+ * compilador: o avanco em tempo de execucao e uma soma
+ */
+constexpr int32_t passoSono(const int16_t *valor, unsigned i) {
+	return (int32_t)(valor[i + 1] - valor[i]) * (1 << SONO_Q) /
+			(int32_t)(sonoMinuto[i + 1] - sonoMinuto[i]);
+}
+
+template<typename Indices> struct TabelaSono;
+template<unsigned... I>
+struct TabelaSono<IndicesCurva<I...> > {
+	static const int32_t acrescimo[sizeof...(I)];
+	static const int32_t teto[sizeof...(I)];
+};
+template<unsigned... I>
+const int32_t TabelaSono<IndicesCurva<I...> >::acrescimo[sizeof...(I)] = {
+	passoSono(sonoAcrescimo, I)...
+};
+template<unsigned... I>
+const int32_t TabelaSono<IndicesCurva<I...> >::teto[sizeof...(I)] = {
+	passoSono(sonoTeto, I)...
+};
+
+typedef TabelaSono<GeraIndicesCurva<SONO_PONTOS - 1>::tipo> PassosSono;
+
+/*
+ * Perfil do modo sleep: a partir de inicia, sobe o setpoint e baixa o
+ * teto do ventilador seguindo PERFIL_SONO. avancaMinuto e chamado a cada
+ * minuto pelo alarme de 60 s do Relogio, no laco principal, e faz
+ * trabalho constante: uma comparacao com o fim do segmento e duas somas,
+ * sem divisao nem busca na tabela. O primeiro passo vem no proximo
+ * minuto do alarme, ate 60 s apos inicia.
+ */
+class PerfilSono {
+public:
+	void inicia();
+	void encerra();
+	void avancaMinuto();
+	bool ativo();
+	int16_t acrescimoSetpoint();
+	uint16_t tetoVentilador();
+
+private:
+	void publica();
+
+	bool ativoAtual = false;
+	uint8_t segmento = 0;
+	uint16_t minuto = 0;
+	int32_t acrescimo = 0;							//Q16
+	int32_t teto = 0;								//Q16
+	int16_t acrescimoAtual = 0;
+	uint16_t tetoAtual = 1000;
+};
+
+#endif /* SOURCES_PERFILSONO_H_ */
@@ -0,0 +1,123 @@
+/*
+ * Psicrometria.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+
+#ifndef SOURCES_PSICROMETRIA_H_
+#define SOURCES_PSICROMETRIA_H_
+
+#include <stdint.h>
+
+/*!
+ * Grade das tabelas: temperatura de 5 em 5 graus, umidade relativa de 10
+ * em 10% a partir de 20% (faixa do DHT11). Valores em decimos de grau.
+ */
+#define PSI_PASSO_T			5
+#define PSI_PASSO_UR		10
+#define PSI_UR_MIN			20
+#define PSI_UR_MAX			100
+#define PSI_T_MAX			50
+#define PSI_COLUNAS			((PSI_UR_MAX - PSI_UR_MIN) / PSI_PASSO_UR + 1)
+#define PSI_SENSACAO_T_MIN	25			//abaixo, sensacao = temperatura
+
+/*!
+ * Ponto de orvalho pela formula de Magnus (a = 17,62, b = 243,12 C),
+ * de 0 a 50 C
+ */
+constexpr int16_t tabelaOrvalho[][PSI_COLUNAS] = {
+	{ -203,  -155,  -120,   -92,   -68,   -48,   -30,   -14,     0},	//0 C
+	{ -162,  -112,   -75,   -46,   -21,     0,    18,    35,    50},	//5 C
+	{ -120,   -68,   -30,     0,    26,    48,    67,    84,   100},	//10 C
+	{  -78,   -25,    15,    47,    73,    96,   116,   134,   150},	//15 C
+	{  -37,    19,    60,    93,   120,   144,   164,   183,   200},	//20 C
+	{    5,    62,   105,   139,   167,   191,   213,   232,   250},	//25 C
+	{   46,   105,   149,   184,   214,   239,   262,   282,   300},	//30 C
+	{   87,   148,   194,   230,   261,   287,   310,   331,   350},	//35 C
+	{  128,   191,   238,   276,   308,   335,   359,   380,   400},	//40 C
+	{  169,   234,   283,   322,   354,   383,   407,   430,   450},	//45 C
+	{  209,   277,   327,   367,   401,   430,   456,   479,   500},	//50 C
+};
+
+/*!
+ * Excesso do indice de calor (NOAA: Steadman abaixo de 80 F, regressao
+ * de Rothfusz com os ajustes acima) sobre a temperatura, de 25 a 50 C
+ */
+constexpr int16_t tabelaSensacao[][PSI_COLUNAS] = {
+	{    0,     0,     0,     0,     0,     0,     0,     0,     0},	//25 C
+	{  -18,   -12,    -3,    10,    28,    50,    77,   108,   144},	//30 C
+	{  -20,    -3,    22,    57,   101,   153,   215,   287,   367},	//35 C
+	{   -6,    31,    83,   148,   226,   319,   425,   545,   679},	//40 C
+	{   22,    91,   178,   283,   406,   547,   706,   882,  1077},	//45 C
+	{   66,   177,   309,   464,   640,   837,  1057,  1298,  1562},	//50 C
+};
+
+constexpr uint8_t PSI_LINHAS_ORVALHO = sizeof(tabelaOrvalho) / sizeof(tabelaOrvalho[0]);
+constexpr uint8_t PSI_LINHAS_SENSACAO = sizeof(tabelaSensacao) / sizeof(tabelaSensacao[0]);
+static_assert(PSI_LINHAS_ORVALHO == PSI_T_MAX / PSI_PASSO_T + 1,
+		"tabela de orvalho incompleta");
+static_assert(PSI_LINHAS_SENSACAO == (PSI_T_MAX - PSI_SENSACAO_T_MIN) / PSI_PASSO_T + 1,
+		"tabela de sensacao incompleta");
+
+/*!
+ * Interpolacao bilinear inteira na grade, com t e ur relativos ao inicio
+ * dela. Sem divisao (o Cortex-M0+ nao tem): x / 5 == (x * 13108) >> 16 e
+ * x / 10 == (x * 6554) >> 16 nas faixas da grade, e a media ponderada
+ * (pesos somando 50) e dividida por 50 com (x * 1311) >> 16.
+ */
+inline int16_t interpolaPsicrometria(const int16_t (*tabela)[PSI_COLUNAS],
+		uint8_t linhas, uint8_t t, uint8_t ur) {
+	uint8_t i = ((uint32_t)t * 13108) >> 16;
+	uint8_t j = ((uint32_t)ur * 6554) >> 16;
+	int32_t ft = t - i * PSI_PASSO_T;
+	int32_t fu = ur - j * PSI_PASSO_UR;
+	uint8_t i1 = (i + 1 < linhas) ? i + 1 : i;
+	uint8_t j1 = (j + 1 < PSI_COLUNAS) ? j + 1 : j;
+	int32_t soma;
+
+	soma = tabela[i][j] * (PSI_PASSO_T - ft) * (PSI_PASSO_UR - fu) +
+			tabela[i1][j] * ft * (PSI_PASSO_UR - fu) +
+			tabela[i][j1] * (PSI_PASSO_T - ft) * fu +
+			tabela[i1][j1] * ft * fu;
+	return (int16_t)((soma * 1311 + (1 << 15)) >> 16);
+}
+
+inline uint8_t limitaUmidade(uint8_t umidade) {
+	if(umidade < PSI_UR_MIN){
+		return PSI_UR_MIN;
+	}
+	return (umidade > PSI_UR_MAX) ? PSI_UR_MAX : umidade;
+}
+
+/*!
+ * Ponto de orvalho, em decimos de grau, para a temperatura (C) e a
+ * umidade (%) inteiras do DHT11
+ */
+inline int16_t pontoOrvalho(int temperatura, uint8_t umidade) {
+	if(temperatura < 0){
+		temperatura = 0;
+	} else if(temperatura > PSI_T_MAX){
+		temperatura = PSI_T_MAX;
+	}
+	return interpolaPsicrometria(tabelaOrvalho, PSI_LINHAS_ORVALHO,
+			temperatura, limitaUmidade(umidade) - PSI_UR_MIN);
+}
+
+/*!
+ * Indice de calor (sensacao termica), em decimos de grau
+ */
+inline int16_t sensacaoTermica(int temperatura, uint8_t umidade) {
+	if(temperatura < PSI_SENSACAO_T_MIN){
+		return temperatura * 10;
+	}
+	if(temperatura > PSI_T_MAX){
+		temperatura = PSI_T_MAX;
+	}
+	return temperatura * 10 + interpolaPsicrometria(tabelaSensacao,
+			PSI_LINHAS_SENSACAO, temperatura - PSI_SENSACAO_T_MIN,
+			limitaUmidade(umidade) - PSI_UR_MIN);
+}
+
+#endif /* SOURCES_PSICROMETRIA_H_ */
@@ -0,0 +1,187 @@
+/*
+ * ReconhecedorGestos.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "ReconhecedorGestos.h"
+#include "FilaEventos.h"
+
+/*
+ * Estados e entradas da maquina de cada botao
+ */
+enum {
+	est_repouso = 0,
+	est_pressionado,		//primeiro toque, aguardando soltar ou longo
+	est_esperaDuplo,		//solto, aguardando o segundo toque
+	est_segundoToque,		//segundo toque, aguardando soltar
+	est_segurando,			//toque longo, repetindo
+	est_total
+};
+
+enum {
+	ent_pressiona = 0,
+	ent_solta,
+	ent_prazo,
+	ent_total
+};
+
+/*
+ * Prazo armado pela transicao
+ */
+enum {
+	pz_nenhum = 0,		//desarma
+	pz_mantem,			//mantem o prazo atual
+	pz_longo,
+	pz_duplo,
+	pz_repete
+};
+
+typedef struct {
+	uint8_t proximo;
+	uint8_t gesto;
+	uint8_t prazo;
+} Transicao;
+
+static const uint16_t duracaoPrazo[] = {
+	0, 0, GESTOS_LONGO, GESTOS_DUPLO, GESTOS_REPETE
+};
+
+/*
+ * Tabela com duplo clique: o clique aguarda a janela do segundo toque
+ */
+static const Transicao tabelaDuplo[est_total][ent_total] = {
+	/* est_repouso */
+	{{est_pressionado, gs_nenhum, pz_longo},
+	 {est_repouso, gs_nenhum, pz_nenhum},
+	 {est_repouso, gs_nenhum, pz_nenhum}},
+	/* est_pressionado */
+	{{est_pressionado, gs_nenhum, pz_mantem},
+	 {est_esperaDuplo, gs_nenhum, pz_duplo},
+	 {est_segurando, gs_longo, pz_repete}},
+	/* est_esperaDuplo */
+	{{est_segundoToque, gs_nenhum, pz_longo},
+	 {est_esperaDuplo, gs_nenhum, pz_mantem},
+	 {est_repouso, gs_clique, pz_nenhum}},
+	/* est_segundoToque */
+	{{est_segundoToque, gs_nenhum, pz_mantem},
+	 {est_repouso, gs_duploClique, pz_nenhum},
+	 {est_segurando, gs_longo, pz_repete}},
+	/* est_segurando */
+	{{est_segurando, gs_nenhum, pz_mantem},
+	 {est_repouso, gs_fimLongo, pz_nenhum},
+	 {est_segurando, gs_repeticao, pz_repete}}
+};
+
+/*
+ * Tabela simples: o clique e emitido ao soltar
+ */
+static const Transicao tabelaSimples[est_total][ent_total] = {
+	/* est_repouso */
+	{{est_pressionado, gs_nenhum, pz_longo},
+	 {est_repouso, gs_nenhum, pz_nenhum},
+	 {est_repouso, gs_nenhum, pz_nenhum}},
+	/* est_pressionado */
+	{{est_pressionado, gs_nenhum, pz_mantem},
+	 {est_repouso, gs_clique, pz_nenhum},
+	 {est_segurando, gs_longo, pz_repete}},
+	/* est_esperaDuplo (nao alcancado) */
+	{{est_pressionado, gs_nenhum, pz_longo},
+	 {est_repouso, gs_nenhum, pz_nenhum},
+	 {est_repouso, gs_nenhum, pz_nenhum}},
+	/* est_segundoToque (nao alcancado) */
+	{{est_pressionado, gs_nenhum, pz_longo},
+	 {est_repouso, gs_nenhum, pz_nenhum},
+	 {est_repouso, gs_nenhum, pz_nenhum}},
+	/* est_segurando */
+	{{est_segurando, gs_nenhum, pz_mantem},
+	 {est_repouso, gs_fimLongo, pz_nenhum},
+	 {est_segurando, gs_repeticao, pz_repete}}
+};
+
+ReconhecedorGestos::ReconhecedorGestos(FilaEventos *fila) {
+	uint8_t i;
+
+	for(i = 0; i < BOTOES_MAX; i++){
+		estado[i] = est_repouso;
+		duplo[i] = false;
+		armado[i] = false;
+		prazo[i] = 0;
+	}
+	eventos = fila;
+}
+
+/*!
+ * Habilita (ou nao) o duplo clique no botao. Deve ser chamado antes de
+ * conectar o reconhecedor ao ServicoBotoes.
+ */
+void ReconhecedorGestos::configura(uint8_t botao, bool duploClique){
+	if(botao >= BOTOES_MAX){
+		return;
+	}
+	duplo[botao] = duploClique;
+	estado[botao] = est_repouso;
+	armado[botao] = false;
+}
+
+/*!
+ * Borda ja sem repiques, com o instante em que foi aceita
+ */
+void ReconhecedorGestos::borda(uint8_t botao, bt_TipoEvento tipo,
+		uint32_t instante){
+	if(botao >= BOTOES_MAX){
+		return;
+	}
+	aplica(botao, tipo == bt_pressionado ? ent_pressiona : ent_solta, instante);
+}
+
+/*!
+ * Chamado a cada tick: aplica a entrada de prazo vencido aos botoes com
+ * prazo armado. Um prazo vence no maximo uma vez por tick.
+ */
+void ReconhecedorGestos::tick(uint32_t agora){
+	uint8_t i;
+
+	for(i = 0; i < BOTOES_MAX; i++){
+		if(armado[i] && Relogio::passou(prazo[i], agora)){
+			aplica(i, ent_prazo, prazo[i]);
+		}
+	}
+}
+
+/*
+ * Uma transicao da tabela. O novo prazo conta a partir do instante da
+ * entrada (borda ou prazo anterior), mantendo a repeticao sem deriva.
+ */
+void ReconhecedorGestos::aplica(uint8_t botao, uint8_t entrada,
+		uint32_t instante){
+	const Transicao *t;
+
+	if(duplo[botao]){
+		t = &tabelaDuplo[estado[botao]][entrada];
+	} else {
+		t = &tabelaSimples[estado[botao]][entrada];
+	}
+	estado[botao] = t->proximo;
+	if(t->prazo == pz_nenhum){
+		armado[botao] = false;
+	} else if(t->prazo != pz_mantem){
+		prazo[botao] = instante + duracaoPrazo[t->prazo];
+		armado[botao] = true;
+	}
+	if(t->gesto != gs_nenhum){
+		publica(botao, (gs_Gesto)t->gesto, instante);
+	}
+}
+
+void ReconhecedorGestos::publica(uint8_t botao, gs_Gesto gesto,
+		uint32_t instante){
+	Evento evento;
+
+	evento.tipo = ev_gesto;
+	evento.gesto.botao = botao;
+	evento.gesto.gesto = gesto;
+	evento.gesto.instante = instante;
+	eventos->publica(&evento);
+}
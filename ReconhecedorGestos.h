@@ -0,0 +1,87 @@
+/*
+ * ReconhecedorGestos.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_RECONHECEDORGESTOS_H_
+#define SOURCES_RECONHECEDORGESTOS_H_
+
+#include <stdint.h>
+#include "ServicoBotoes.h"
+#include "Relogio.h"
+
+#define GESTOS_LONGO		RELOGIO_MS(800)		//segurar ate o toque longo
+#define GESTOS_DUPLO		RELOGIO_MS(300)		//janela do segundo clique
+#define GESTOS_REPETE		RELOGIO_MS(200)		//periodo da repeticao
+
+typedef enum {
+	gs_nenhum = 0,
+	gs_clique,
+	gs_duploClique,
+	gs_longo,			//botao segurado por GESTOS_LONGO
+	gs_repeticao,		//a cada GESTOS_REPETE enquanto segurado
+	gs_fimLongo,		//botao solto apos gs_longo
+	gs_gestos
+} gs_Gesto;
+
+typedef struct {
+	uint8_t botao;
+	gs_Gesto gesto;
+	uint32_t instante;		//em ticks
+} EventoGesto;
+
+class FilaEventos;
+
+/*!
+ *  @class    ReconhecedorGestos
+ *
+ *  @brief    Converte as bordas dos botoes em clique, duplo clique, toque
+ *            longo e repeticao.
+ *
+ *  @details  Cada botao tem uma maquina de estados dirigida por tabela:
+ *            a entrada (pressiona, solta ou prazo vencido) e o estado
+ *            atual indexam a transicao, que da o proximo estado, o gesto
+ *            emitido e o prazo a armar. Cada atualizacao tem custo
+ *            constante, sem lacos de espera, e roda dentro do tick do
+ *            PIT (ServicoBotoes::tick).
+ *
+ *            Os prazos sao instantes do Relogio; as bordas trazem o
+ *            instante em que o debounce as aceitou, de modo que a
+ *            latencia do debounce nao altera os tempos medidos.
+ *
+ *            Botoes sem duplo clique usam a tabela simples e emitem o
+ *            clique logo ao soltar; com duplo clique, o clique so e
+ *            emitido quando a janela GESTOS_DUPLO termina sem segundo
+ *            toque.
+ *
+ *            Os gestos sao publicados como ev_gesto na FilaEventos.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *        +fn ReconhecedorGestos gestos(&fila);
+ *        +fn configura(botao, true);            //habilita duplo clique
+ *        +fn botoes.conectaGestos(&gestos);
+ */
+class ReconhecedorGestos {
+public:
+	ReconhecedorGestos(FilaEventos *fila);
+
+	void configura(uint8_t botao, bool duploClique);
+	void borda(uint8_t botao, bt_TipoEvento tipo, uint32_t instante);
+	void tick(uint32_t agora);
+
+private:
+	void aplica(uint8_t botao, uint8_t entrada, uint32_t instante);
+	void publica(uint8_t botao, gs_Gesto gesto, uint32_t instante);
+
+	uint8_t estado[BOTOES_MAX];
+	bool duplo[BOTOES_MAX];
+	bool armado[BOTOES_MAX];
+	uint32_t prazo[BOTOES_MAX];
+
+	FilaEventos *eventos;
+};
+
+#endif /* SOURCES_RECONHECEDORGESTOS_H_ */
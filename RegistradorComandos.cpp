@@ -7,9 +7,15 @@
 
 #include <RegistradorComandos.h>
 
-RegistradorComandos::RegistradorComandos() {
-	// TODO Auto-generated constructor stub
+/*!
+ * Tabela tecla -> acao gerada em tempo de compilacao (256 bytes em flash).
+ */
+typedef TabelaComandos<GeraIndicesTeclas<256>::tipo> TabelaTeclas;
 
+RegistradorComandos::RegistradorComandos() {
+	comando = -1;
+	protocolo = 0;
+	endereco = 0;
 }
 
 RegistradorComandos::~RegistradorComandos() {
@@ -18,25 +24,67 @@ RegistradorComandos::~RegistradorComandos() {
 
 void RegistradorComandos::armazenaComando(int dt_IR){
 	comando = dt_IR;
+	protocolo = 0;
+	endereco = 0;
 }
 
-int RegistradorComandos::identificaComando(int comando){
-	switch(comando){
-	case 00110000: return 0;
-	break;
-	case 01001011: return 1;
-	break;
-	case 01010101: return 2;
-	break;
-	case 01010100: return 3;
-	break;
-	default: return 4;
+/*!
+ * Armazena o quadro completo recebido, para busca das teclas aprendidas
+ */
+void RegistradorComandos::armazenaQuadro(uint8_t protocolo, uint16_t endereco, uint8_t comando){
+	this->comando = comando;
+	this->protocolo = protocolo;
+	this->endereco = endereco;
+}
+
+/*!
+ * Retorna a acao associada ao codigo da tecla, ou cmd_nenhum para
+ * codigos nao declarados
+ */
+cmd_Acao RegistradorComandos::identificaComando(int comando){
+	if(comando < 0 || comando > 0xFF){
+		return cmd_nenhum;
 	}
+	return (cmd_Acao)TabelaTeclas::acoes[comando];
 }
 
-int RegistradorComandos::enviaComando(int wr_RC){
-	if(wr_RC == 1){
-		return identificaComando(comando);
+/*!
+ * Retorna a acao do ultimo comando armazenado se wr_RC == 1
+ */
+cmd_Acao RegistradorComandos::enviaComando(int wr_RC){
+	uint8_t aprendida;
+
+	if(wr_RC != 1){
+		return cmd_nenhum;
 	}
+	if(protocolo != 0 && comando >= 0 && comando <= 0xFF){
+		aprendida = memoria.busca(protocolo, endereco, comando);
+		if(aprendida != cmd_nenhum && aprendida < cmd_total){
+			return (cmd_Acao)aprendida;
+		}
+	}
+	return identificaComando(comando);
 }
 
+/*!
+ * Carrega da flash as teclas aprendidas (executado no boot)
+ */
+void RegistradorComandos::carregaAprendidos(){
+	memoria.carrega();
+}
+
+/*!
+ * Associa a tecla do controle remoto a acao (modo aprendizado). O vinculo
+ * vale imediatamente, mas so e gravado na flash por gravaAprendidos().
+ * Retorna false se a memoria de teclas esta cheia.
+ */
+bool RegistradorComandos::aprende(uint8_t protocolo, uint16_t endereco, uint8_t comando, cmd_Acao acao){
+	return memoria.aprende(protocolo, endereco, comando, acao);
+}
+
+/*!
+ * Grava na flash, de uma vez, os vinculos aprendidos pendentes
+ */
+flash_Exception RegistradorComandos::gravaAprendidos(){
+	return memoria.grava();
+}
@@ -8,15 +8,119 @@
 #ifndef SOURCES_REGISTRADORCOMANDOS_H_
 #define SOURCES_REGISTRADORCOMANDOS_H_
 
+#include <stdint.h>
+#include "MemoriaComandos.h"
+
+/*!
+ * Acoes executadas pelo Ar Condicionado, comuns ao controle remoto e
+ * aos botoes do painel.
+ */
+typedef enum {
+	cmd_nenhum = 0,
+	cmd_power,
+	cmd_ventilador,
+	cmd_sleep,
+	cmd_reset,
+	cmd_setpointMais,
+	cmd_setpointMenos,
+	cmd_bloqueio,		//trava infantil dos botoes do painel
+	cmd_servico,		//modo de servico (aprendizado de teclas)
+	cmd_swing,			//modo da aleta (parada, completa, superior, inferior)
+	cmd_swingVelocidade,	//velocidade da varredura da aleta
+	cmd_sintonia,		//sintonia por rele do PID do ventilador
+	cmd_seco,			//modo seco (desumidificacao)
+	cmd_total
+} cmd_Acao;
+
+/*!
+ * Declaracao unica das teclas do controle remoto: X(codigo, acao).
+ * A tabela de busca de 256 posicoes e gerada a partir desta lista em
+ * tempo de compilacao.
+ */
+#define COMANDOS_TECLAS(X) \
+	X(0x30, cmd_power) \
+	X(0x4B, cmd_ventilador) \
+	X(0x55, cmd_sleep) \
+	X(0x54, cmd_reset) \
+	X(0x46, cmd_setpointMais) \
+	X(0x15, cmd_setpointMenos)
+
+#define COMANDOS_CASO(codigo, acao) (tecla == (codigo)) ? (acao) :
+
+/*!
+ * Acao associada a tecla, avaliada pelo compilador ao gerar a tabela.
+ */
+constexpr cmd_Acao acaoDaTecla(unsigned tecla) {
+	return COMANDOS_TECLAS(COMANDOS_CASO) cmd_nenhum;
+}
+
+/*!
+ * Uma tecla declarada duas vezes ficaria com a acao da primeira ocorrencia.
+ */
+#define COMANDOS_VERIFICA(codigo, acao) \
+	static_assert(acaoDaTecla(codigo) == (acao), "tecla declarada duas vezes");
+COMANDOS_TECLAS(COMANDOS_VERIFICA)
+
+/*!
+ * Geracao da sequencia de indices 0..N-1 (equivalente C++11 do
+ * std::make_index_sequence) usada para preencher a tabela.
+ */
+template<unsigned... I> struct IndicesTeclas {};
+template<unsigned N, unsigned... I>
+struct GeraIndicesTeclas : GeraIndicesTeclas<N - 1, N - 1, I...> {};
+template<unsigned... I>
+struct GeraIndicesTeclas<0, I...> {
+	typedef IndicesTeclas<I...> tipo;
+};
+
+template<typename Indices> struct TabelaComandos;
+template<unsigned... I>
+struct TabelaComandos<IndicesTeclas<I...> > {
+	static const uint8_t acoes[sizeof...(I)];
+};
+template<unsigned... I>
+const uint8_t TabelaComandos<IndicesTeclas<I...> >::acoes[sizeof...(I)] = {
+	static_cast<uint8_t>(acaoDaTecla(I))...
+};
+
+/*!
+ *  @class    RegistradorComandos
+ *
+ *  @brief    Armazena o comando recebido do controle remoto e o converte
+ *            na acao correspondente.
+ *
+ *  @details  A conversao e uma indexacao direta na tabela gerada a partir
+ *            de COMANDOS_TECLAS (custo constante, sem comparacoes).
+ *            Teclas aprendidas (MemoriaComandos) tem prioridade sobre a
+ *            tabela de compilacao, permitindo trocar o controle remoto
+ *            sem regravar o firmware.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *        +fn void armazenaComando(int dt_IR);
+ *        +fn void armazenaQuadro(protocolo, endereco, comando);
+ *        +fn cmd_Acao enviaComando(int wr_RC);
+ *        +fn bool aprende(protocolo, endereco, comando, acao);
+ */
 class RegistradorComandos {
 public:
 	RegistradorComandos();
 	virtual ~RegistradorComandos();
 
 	int comando;
+	uint8_t protocolo;
+	uint16_t endereco;
 	void armazenaComando(int dt_IR);
-	int identificaComando(int comando);
-	int enviaComando(int wr_RC);
+	void armazenaQuadro(uint8_t protocolo, uint16_t endereco, uint8_t comando);
+	cmd_Acao identificaComando(int comando);
+	cmd_Acao enviaComando(int wr_RC);
+
+	void carregaAprendidos();
+	bool aprende(uint8_t protocolo, uint16_t endereco, uint8_t comando, cmd_Acao acao);
+	flash_Exception gravaAprendidos();
+
+private:
+	MemoriaComandos memoria;
 
 };
 
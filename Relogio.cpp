@@ -0,0 +1,64 @@
+/*
+ * Relogio.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "Relogio.h"
+#include "MKL25Z4.h"
+
+volatile uint32_t Relogio::ticks = 0;
+
+/*!
+ * Avanca um tick. Chamado apenas em PIT_IRQHandler.
+ */
+void Relogio::tick(){
+	ticks++;
+}
+
+/*!
+ * Tempo desde o inicio, em ticks
+ */
+uint32_t Relogio::agora(){
+	return ticks;
+}
+
+/*!
+ * Verdadeiro se o instante ja foi alcancado
+ */
+bool Relogio::passou(uint32_t instante){
+	return passou(instante, ticks);
+}
+
+/*!
+ * Verdadeiro se a referencia e igual ou posterior ao instante, mesmo
+ * apos a volta do contador
+ */
+bool Relogio::passou(uint32_t instante, uint32_t referencia){
+	return (int32_t)(referencia - instante) >= 0;
+}
+
+/*!
+ * Coloca o SysTick em contagem livre pelo clock do nucleo, sem
+ * interrupcao
+ */
+void Relogio::iniciaCiclos(){
+	SysTick->LOAD = RELOGIO_CICLOS;
+	SysTick->VAL = 0;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+/*!
+ * Valor atual do contador de ciclos (decrescente)
+ */
+uint32_t Relogio::ciclos(){
+	return SysTick->VAL;
+}
+
+/*!
+ * Ciclos do nucleo desde a leitura inicio de ciclos()
+ */
+uint32_t Relogio::decorrido(uint32_t inicio){
+	return (inicio - SysTick->VAL) & RELOGIO_CICLOS;
+}
@@ -0,0 +1,67 @@
+/*
+ * Relogio.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_RELOGIO_H_
+#define SOURCES_RELOGIO_H_
+
+#include <stdint.h>
+
+#define RELOGIO_TICK_MS		10					//periodo do PIT ch0
+#define RELOGIO_MS(ms)		((ms) / RELOGIO_TICK_MS)
+#define RELOGIO_BUS_HZ		20970000UL			//clock do barramento (PIT)
+
+/*
+ * LDVAL do PIT para o tick: o canal conta LDVAL + 1 ciclos do barramento
+ * por periodo
+ */
+#define RELOGIO_PIT_LDVAL	(RELOGIO_BUS_HZ / 1000 * RELOGIO_TICK_MS - 1)
+
+static_assert((RELOGIO_PIT_LDVAL + 1) * 1000 / RELOGIO_BUS_HZ == RELOGIO_TICK_MS,
+		"LDVAL do PIT diferente do periodo do tick");
+#define RELOGIO_CICLOS		0x00FFFFFF			//contador SysTick (24 bits)
+
+/*!
+ *  @class    Relogio
+ *
+ *  @brief    Base de tempo monotonica compartilhada, em ticks do PIT.
+ *
+ *  @details  O contador e incrementado uma unica vez por tick, na rotina
+ *            PIT_IRQHandler, e lido por todos os servicos que precisam
+ *            marcar instantes ou medir intervalos (botoes, gestos). A
+ *            leitura de 32 bits e atomica no Cortex-M0+.
+ *
+ *            O contador da a volta apos ~497 dias; as comparacoes devem
+ *            usar passou(), que trata a volta pela diferenca com sinal.
+ *
+ *            Para medir intervalos curtos (latencia), o SysTick fica
+ *            livre, sem interrupcao, contando ciclos do nucleo em 24
+ *            bits: decorrido() e valido para intervalos menores que
+ *            2^24 ciclos (~0,8 s a 20,97 MHz).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *        +fn Relogio::tick();                  //PIT_IRQHandler
+ *        +fn uint32_t t = Relogio::agora();
+ *        +fn if(Relogio::passou(prazo)) ...
+ *        +fn Relogio::iniciaCiclos();
+ *        +fn uint32_t c = Relogio::ciclos(); ... Relogio::decorrido(c);
+ */
+class Relogio {
+public:
+	static void tick();
+	static uint32_t agora();
+	static bool passou(uint32_t instante);
+	static bool passou(uint32_t instante, uint32_t referencia);
+	static void iniciaCiclos();
+	static uint32_t ciclos();
+	static uint32_t decorrido(uint32_t inicio);
+
+private:
+	static volatile uint32_t ticks;
+};
+
+#endif /* SOURCES_RELOGIO_H_ */
@@ -0,0 +1,177 @@
+/*
+ * ServicoBotoes.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "ServicoBotoes.h"
+#include "ReconhecedorGestos.h"
+
+ServicoBotoes::ServicoBotoes() {
+	numBotoes = 0;
+	numPortas = 0;
+	escrita = 0;
+	leitura = 0;
+	descartados = 0;
+	gestos = 0;
+}
+
+/*!
+ * Registra o botao (pino ja configurado como entrada com pull-up) e
+ * habilita a sua interrupcao nas duas bordas. Retorna o indice usado
+ * nos eventos, ou BOTOES_MAX se nao houver espaco.
+ */
+uint8_t ServicoBotoes::adiciona(mkl_GPIOInterrupt *pino){
+	uint8_t botao = numBotoes;
+	uint8_t porta;
+
+	if(numBotoes >= BOTOES_MAX){
+		return BOTOES_MAX;
+	}
+	porta = portaDoBotao(pino->portName());
+	if(porta >= BOTOES_PORTAS){
+		return BOTOES_MAX;
+	}
+	pinos[botao] = pino;
+	portaBotao[botao] = porta;
+	numBotoes++;
+	portas[porta].addPins(pino->pinMask());
+	pino->enableInterrupt(gpio_irqBoth);
+	return botao;
+}
+
+/*!
+ * Chamado nas rotinas PORTA_IRQHandler e PORTD_IRQHandler: limpa a flag
+ * de cada botao que interrompeu e ativa a amostragem da sua porta
+ */
+void ServicoBotoes::trataInterrupcao(){
+	uint8_t i;
+
+	for(i = 0; i < numBotoes; i++){
+		if(pinos[i]->isInterruptFlagSet()){
+			pinos[i]->clearInterruptFlag();
+			portaAtiva[portaBotao[i]] = true;
+		}
+	}
+}
+
+/*!
+ * Chamado a cada interrupcao do PIT (10 ms), apos Relogio::tick():
+ * amostra as portas ativas, gera os eventos dos pinos que mudaram de
+ * estado e avanca os prazos dos gestos
+ */
+void ServicoBotoes::tick(){
+	uint8_t p, i;
+	uint32_t pressionados, soltos;
+
+	for(p = 0; p < numPortas; p++){
+		if(!portaAtiva[p]){
+			continue;
+		}
+		portas[p].sample();
+		pressionados = portas[p].readPressed();
+		soltos = portas[p].readReleased();
+		if(pressionados | soltos){
+			for(i = 0; i < numBotoes; i++){
+				if(portaBotao[i] != p){
+					continue;
+				}
+				if(pressionados & pinos[i]->pinMask()){
+					publica(i, bt_pressionado);
+				}
+				if(soltos & pinos[i]->pinMask()){
+					publica(i, bt_solto);
+				}
+			}
+		}
+		if(portas[p].isSettled()){
+			portaAtiva[p] = false;
+		}
+	}
+	if(gestos){
+		gestos->tick(Relogio::agora());
+	}
+}
+
+/*!
+ * Passa as bordas dos botoes ao reconhecedor de gestos, no lugar da
+ * fila de eventos
+ */
+void ServicoBotoes::conectaGestos(ReconhecedorGestos *reconhecedor){
+	gestos = reconhecedor;
+}
+
+/*!
+ * Retira o proximo evento da fila. Retorna false se a fila esta vazia.
+ */
+bool ServicoBotoes::proximoEvento(EventoBotao *evento){
+	if(leitura == escrita){
+		return false;
+	}
+	*evento = fila[leitura];
+	leitura = (leitura + 1) & (BOTOES_EVENTOS - 1);
+	return true;
+}
+
+/*!
+ * Estado atual (ja sem repiques) do botao
+ */
+bool ServicoBotoes::pressionado(uint8_t botao){
+	if(botao >= numBotoes){
+		return false;
+	}
+	return (portas[portaBotao[botao]].state() & pinos[botao]->pinMask()) != 0;
+}
+
+/*!
+ * Tempo desde o inicio, em ticks do PIT (Relogio)
+ */
+uint32_t ServicoBotoes::agora(){
+	return Relogio::agora();
+}
+
+/*!
+ * Eventos descartados por fila cheia
+ */
+uint16_t ServicoBotoes::perdidos(){
+	return descartados;
+}
+
+/*!
+ * Indice do debounce da porta, criado no primeiro botao da porta
+ */
+uint8_t ServicoBotoes::portaDoBotao(gpio_Name nome){
+	uint8_t p;
+
+	for(p = 0; p < numPortas; p++){
+		if(nomePorta[p] == nome){
+			return p;
+		}
+	}
+	if(numPortas >= BOTOES_PORTAS){
+		return BOTOES_PORTAS;
+	}
+	portas[numPortas] = mkl_PortDebouncer(nome);
+	nomePorta[numPortas] = nome;
+	portaAtiva[numPortas] = false;
+	return numPortas++;
+}
+
+void ServicoBotoes::publica(uint8_t botao, bt_TipoEvento tipo){
+	uint8_t proxima;
+
+	if(gestos){
+		gestos->borda(botao, tipo, Relogio::agora());
+		return;
+	}
+	proxima = (escrita + 1) & (BOTOES_EVENTOS - 1);
+	if(proxima == leitura){
+		descartados++;
+		return;
+	}
+	fila[escrita].botao = botao;
+	fila[escrita].tipo = tipo;
+	fila[escrita].instante = Relogio::agora();
+	escrita = proxima;
+}
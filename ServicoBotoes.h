@@ -0,0 +1,99 @@
+/*
+ * ServicoBotoes.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#ifndef SOURCES_SERVICOBOTOES_H_
+#define SOURCES_SERVICOBOTOES_H_
+
+#include <stdint.h>
+#include "mkl_GPIOInterrupt.h"
+#include "mkl_PortDebouncer.h"
+#include "Relogio.h"
+
+#define BOTOES_MAX			8
+#define BOTOES_PORTAS		2		//portas com interrupcao: A e D
+#define BOTOES_EVENTOS		16		//potencia de 2
+
+typedef enum {
+	bt_pressionado = 0,
+	bt_solto
+} bt_TipoEvento;
+
+typedef struct {
+	uint8_t botao;
+	bt_TipoEvento tipo;
+	uint32_t instante;		//em ticks
+} EventoBotao;
+
+class ReconhecedorGestos;
+
+/*!
+ *  @class    ServicoBotoes
+ *
+ *  @brief    Gera eventos de pressionar/soltar dos botoes.
+ *
+ *  @details  Cada botao (ativo em nivel baixo, com pull-up) interrompe nas
+ *            duas bordas. A interrupcao apenas ativa a porta do botao;
+ *            enquanto ativa, a porta inteira e amostrada a cada tick do
+ *            PIT por um debounce de contadores verticais
+ *            (mkl_PortDebouncer), com custo fixo por porta, independente
+ *            do numero de botoes. Quando todos os pinos estabilizam, a
+ *            porta volta a ficar inativa e o tick nao custa nada.
+ *
+ *            Uma mudanca e aceita apos 4 amostras iguais (40 ms). Os
+ *            eventos vao para uma fila circular consumida pelo laco
+ *            principal, que nunca espera o botao ser solto.
+ *
+ *            Com um ReconhecedorGestos conectado, as bordas vao para ele
+ *            (ainda no tick) em vez da fila, e o laco principal consome
+ *            apenas os gestos.
+ *
+ *            A fila tem um produtor (tick) e um consumidor (laco
+ *            principal). PORTA, PORTD e PIT devem ter a mesma prioridade,
+ *            de modo que as rotinas de interrupcao nao se interrompem.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *        +fn uint8_t adiciona(&pino);
+ *        +fn void trataInterrupcao();   //PORTA_IRQHandler/PORTD_IRQHandler
+ *        +fn void tick();               //PIT_IRQHandler
+ *        +fn bool proximoEvento(&evento);
+ *        +fn void conectaGestos(&gestos);
+ */
+class ServicoBotoes {
+public:
+	ServicoBotoes();
+
+	uint8_t adiciona(mkl_GPIOInterrupt *pino);
+	void trataInterrupcao();
+	void tick();
+	void conectaGestos(ReconhecedorGestos *reconhecedor);
+	bool proximoEvento(EventoBotao *evento);
+	bool pressionado(uint8_t botao);
+	uint32_t agora();
+	uint16_t perdidos();
+
+private:
+	uint8_t portaDoBotao(gpio_Name nome);
+	void publica(uint8_t botao, bt_TipoEvento tipo);
+
+	mkl_GPIOInterrupt *pinos[BOTOES_MAX];
+	uint8_t portaBotao[BOTOES_MAX];
+	uint8_t numBotoes;
+
+	mkl_PortDebouncer portas[BOTOES_PORTAS];
+	gpio_Name nomePorta[BOTOES_PORTAS];
+	volatile bool portaAtiva[BOTOES_PORTAS];
+	uint8_t numPortas;
+
+	EventoBotao fila[BOTOES_EVENTOS];
+	volatile uint8_t escrita;
+	volatile uint8_t leitura;
+	volatile uint16_t descartados;
+	ReconhecedorGestos *gestos;
+};
+
+#endif /* SOURCES_SERVICOBOTOES_H_ */
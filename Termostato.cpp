@@ -0,0 +1,89 @@
+/*
+ * Termostato.cpp
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+#include "Termostato.h"
+#include "CurvaVentilador.h"
+
+static_assert(TERMO_ESCALA == 10, "atualiza divide por 10 com multiplicacao");
+
+Termostato::Termostato() {
+	calculaLimites();
+}
+
+void Termostato::ajustaSetpoint(int16_t decimos){
+	setpointAtual = decimos;
+	calculaLimites();
+}
+
+/*
+ * Largura total da banda morta, limitada a faixa aceita
+ */
+void Termostato::ajustaHisterese(uint8_t decimos){
+	if(decimos < TERMO_HISTERESE_MIN){
+		decimos = TERMO_HISTERESE_MIN;
+	} else if(decimos > TERMO_HISTERESE_MAX){
+		decimos = TERMO_HISTERESE_MAX;
+	}
+	histerese = decimos;
+	calculaLimites();
+}
+
+/*
+ * Nova leitura valida: decide o compressor pela histerese e a
+ * ventilacao pelo desvio arredondado para graus inteiros. O Cortex-M0+
+ * nao tem divisao em hardware: o desvio e limitado a faixa da curva e
+ * deslocado para positivo, e x / 10 == (x * 6554) >> 16 para x < 16389.
+ */
+void Termostato::atualiza(int16_t temperatura){
+	int16_t desvio = temperatura - setpointAtual;
+	uint16_t deslocado;
+
+	falhas = 0;
+	if(temperatura >= limiteLiga){
+		compressorLigado = true;
+	} else if(temperatura <= limiteDesliga){
+		compressorLigado = false;
+	}
+	if(desvio < CURVA_DELTA_MIN * TERMO_ESCALA){
+		desvio = CURVA_DELTA_MIN * TERMO_ESCALA;
+	} else if(desvio > CURVA_DELTA_MAX * TERMO_ESCALA){
+		desvio = CURVA_DELTA_MAX * TERMO_ESCALA;
+	}
+	deslocado = desvio - CURVA_DELTA_MIN * TERMO_ESCALA + TERMO_ESCALA / 2;
+	percentualVentilacao = TabelaVentilador::percentual[
+			((uint32_t)deslocado * 6554) >> 16];
+}
+
+void Termostato::falhaSensor(){
+	if(falhas < TERMO_FALHAS_MAX){
+		falhas++;
+	}
+	if(falhas >= TERMO_FALHAS_MAX){
+		compressorLigado = false;
+	}
+}
+
+bool Termostato::compressor(){
+	return compressorLigado;
+}
+
+/*
+ * Percentual do ventilador no modo automatico (0 antes da primeira
+ * leitura)
+ */
+uint8_t Termostato::ventilacao(){
+	return percentualVentilacao;
+}
+
+int16_t Termostato::setpoint(){
+	return setpointAtual;
+}
+
+void Termostato::calculaLimites(){
+	limiteLiga = setpointAtual + histerese / 2;
+	limiteDesliga = setpointAtual - (histerese - histerese / 2);
+}
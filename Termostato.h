@@ -0,0 +1,62 @@
+/*
+ * Termostato.h
+ *
+ *  Created on: 19/10/2026
+ *      Author: felipedmsantos
+ */
+
+
+#ifndef SOURCES_TERMOSTATO_H_
+#define SOURCES_TERMOSTATO_H_
+
+#include <stdint.h>
+
+/*
+ * Temperaturas em decimos de grau Celsius (inteiros)
+ */
+#define TERMO_ESCALA			10
+#define TERMO_SETPOINT_PADRAO	240
+#define TERMO_HISTERESE_PADRAO	20			//banda morta total
+#define TERMO_HISTERESE_MIN		2
+#define TERMO_HISTERESE_MAX		60
+#define TERMO_FALHAS_MAX		3			//leituras invalidas seguidas
+
+/*
+ * Termostato de refrigeracao por histerese, so com aritmetica inteira.
+ * O compressor liga quando a temperatura chega a setpoint + metade da
+ * banda morta e desliga em setpoint - metade; dentro da banda mantem o
+ * estado. A ventilacao (percentual do ventilador no modo automatico,
+ * base do ControladorPID) segue a CurvaVentilador pelo desvio em relacao
+ * ao setpoint.
+ *
+ * atualiza deve ser chamado a cada leitura valida do sensor e
+ * falhaSensor a cada leitura invalida: as saidas so mudam nessas
+ * chamadas. Apos TERMO_FALHAS_MAX falhas seguidas o compressor e
+ * desligado ate a proxima leitura valida. Nao acessa o hardware:
+ * compressor() e a demanda, aplicada pelo Compressor com os tempos de
+ * protecao.
+ */
+class Termostato {
+public:
+	Termostato();
+	void ajustaSetpoint(int16_t decimos);
+	void ajustaHisterese(uint8_t decimos);
+	void atualiza(int16_t temperatura);
+	void falhaSensor();
+	bool compressor();
+	uint8_t ventilacao();
+	int16_t setpoint();
+
+private:
+	void calculaLimites();
+
+	int16_t setpointAtual = TERMO_SETPOINT_PADRAO;
+	uint8_t histerese = TERMO_HISTERESE_PADRAO;
+	int16_t limiteLiga;
+	int16_t limiteDesliga;
+	bool compressorLigado = false;
+	uint8_t percentualVentilacao = 0;
+	uint8_t falhas = 0;
+};
+
+#endif /* SOURCES_TERMOSTATO_H_ */
@@ -11,8 +11,38 @@
 
 
 
+/*
+ * Perfis padrao: partida suave mais longa para a velocidade maxima e
+ * parada em 1,5 s. O perfil de vel0 vale para todo destino abaixo de
+ * vel1 (percentuais baixos, demanda do PID e modo seco) e tambem sobe
+ * em rampa.
+ */
+static constexpr PerfilRampa perfisPadrao[VENT_VELOCIDADES] = {
+	{1500, 1500},	//vel0 e destinos abaixo de vel1
+	{1500, 1000},	//vel1
+	{1500, 1000},	//vel2
+	{2500, 1000}	//vel3
+};
+
+/*
+ * Toda velocidade, fixa ou continua, cai em algum perfil: nenhum pode
+ * partir em degrau
+ */
+constexpr bool perfisSuaves(uint8_t i = 0) {
+	return i >= VENT_VELOCIDADES ||
+			(perfisPadrao[i].subidaMs > 0 && perfisSuaves(i + 1));
+}
+
+static_assert(perfisSuaves(), "perfil padrao sem rampa de subida");
+
 Ventilador::Ventilador(tpm_Pin pin) {
+	uint8_t i;
+
 	this->ventPwm = mkl_TPMPulseWidthModulation(pin);
+	for(i = 0; i < VENT_VELOCIDADES; i++){
+		passoSubida[i] = passoRampa(perfisPadrao[i].subidaMs);
+		passoDescida[i] = passoRampa(perfisPadrao[i].descidaMs);
+	}
 }
 
 Ventilador::~Ventilador() {
@@ -22,6 +52,7 @@ Ventilador::~Ventilador() {
 void Ventilador::desligaVel(){
 	selecionaVel(vel0);
 	selVel = 0;
+	ventiladorTravado = false;
 }
 
 void Ventilador::mantemVel(){
@@ -35,40 +66,289 @@ void Ventilador::mantemVel(){
 		case 3:
 			this->selecionaVel(vel3);
 			break;
+		case VENT_AUTOMATICO:		//percentual aplicado por acompanhaDemanda
+			break;
 	}
 }
 
 void Ventilador::selecionaVel(vel v) {
+	if(v == vel0){		//desliga mesmo vindo do modo automatico ou seco
+		ajustaRotacao(0);
+		aplicaDuty(0);
+		return;
+	}
+	if(tacometro != 0){
+		if(rotacaoVel(v) != rpmAlvo){
+			ajustaRotacao(rotacaoVel(v));
+			saidaPI = (int32_t)v << VENT_PI_Q;		//parte do duty nominal
+			aplicaDuty(v);
+		}
+		return;
+	}
+	aplicaDuty(v);
+}
+
+/*
+ * Velocidade continua, de 0 a 100% do periodo. A rampa e a do perfil da
+ * maior velocidade fixa que nao excede o destino (vel0 abaixo de vel1).
+ */
+void Ventilador::ajustaPercentual(uint8_t percentual) {
+	if(percentual > 100){
+		percentual = 100;
+	}
+	ajustaMilesimos((uint16_t)percentual * (VENT_DUTY_ESCALA / 100));
+}
+
+/*
+ * Duty cycle em malha aberta, em milesimos do periodo, em qualquer modo
+ * (modo seco); mesma rampa de ajustaPercentual
+ */
+void Ventilador::ajustaMilesimos(uint16_t milesimos) {
+	if(milesimos > VENT_DUTY_ESCALA){
+		milesimos = VENT_DUTY_ESCALA;
+	}
+	rpmAlvo = 0;
+	aplicaDuty(milesimos);
+}
+
+/*
+ * No modo automatico, leva o ventilador ao duty cycle pedido pelo
+ * controlador, em milesimos do periodo
+ */
+void Ventilador::acompanhaDemanda(uint16_t milesimos) {
+	if(selVel != VENT_AUTOMATICO){
+		return;
+	}
+	ajustaMilesimos(milesimos);
+}
+
+/*
+ * Teto do duty cycle, em milesimos, para qualquer modo (perfil do sleep);
+ * vale na proxima aplicacao do duty cycle, a cada atualizacao
+ */
+void Ventilador::limitaDuty(uint16_t milesimos) {
+	tetoDuty = milesimos;
+}
+
+/*
+ * Altera o perfil de rampa da velocidade, e dos destinos continuos entre
+ * ela e a proxima velocidade fixa; vale a partir da proxima mudanca de
+ * velocidade. Tempo 0 muda o duty cycle em um unico periodo.
+ */
+void Ventilador::configuraRampa(vel v, uint16_t subidaMs, uint16_t descidaMs){
+	uint8_t i = indicePerfil(v);
+
+	passoSubida[i] = passoRampa(subidaMs);
+	passoDescida[i] = passoRampa(descidaMs);
+}
+
+/*
+ * Chamado no estouro do TPM: avanca um passo da rampa e escreve o CnV em
+ * buffer, copiado na proxima virada. A fracao do duty cycle acumula no
+ * residuo; quando ele transborda, o periodo recebe uma contagem a mais.
+ */
+void Ventilador::trataInterrupcao(){
+	uint32_t cnv;
 
-	ventPwm.setFrequency(tpm_div16, 999);
+	ventPwm.clearOverflowFlag();
+	if(rampaAtiva){
+		periodosRampa++;
+		if(duty < alvo){
+			duty = (alvo - duty > passo) ? duty + passo : alvo;
+		} else if(duty > alvo){
+			duty = (duty - alvo > passo) ? duty - passo : alvo;
+		}
+		if(duty == alvo){
+			duracaoRampa = periodosRampa;
+			rampaAtiva = false;
+		}
+	}
+	residuo += duty & VENT_DUTY_FRACAO;
+	cnv = (duty >> VENT_RAMPA_Q) + (residuo >> VENT_RAMPA_Q);
+	residuo &= VENT_DUTY_FRACAO;
+	ventPwm.updateDutyCycle(cnv);
+	if(!rampaAtiva && (duty & VENT_DUTY_FRACAO) == 0){
+		ventPwm.disableOverflowInterrupt();
+	}
+}
+
+bool Ventilador::emRampa(){
+	return rampaAtiva;
+}
 
-	switch(v) {
-	    case vel0:
-	    	ventPwm.setDutyCycle(vel0);
-	    	ventPwm.enableOperation();
-	    	break;
+/*
+ * Valor de CnV aplicado pela rampa, sem a fracao do sigma-delta
+ */
+uint16_t Ventilador::dutyAtual(){
+	return duty >> VENT_RAMPA_Q;
+}
+
+/*
+ * Duracao da ultima rampa concluida
+ */
+uint32_t Ventilador::tempoRampaMs(){
+	return duracaoRampa * 1000 / VENT_PWM_HZ;
+}
+
+/*
+ * Habilita a malha fechada de rotacao e a deteccao de travamento
+ */
+void Ventilador::conectaTacometro(mkl_TPMTachometer *tacometro){
+	this->tacometro = tacometro;
+}
+
+/*
+ * Rotacao de destino em malha fechada; 0 desliga o ventilador. O PI
+ * parte do duty cycle atual.
+ */
+void Ventilador::ajustaRotacao(uint16_t rpm){
+	if(rpm == rpmAlvo){
+		return;
+	}
+	rpmAlvo = rpm;
+	erroAnterior = 0;
+	saidaPI = (int32_t)(dutyAplicado > 0 ? dutyAplicado : 0) << VENT_PI_Q;
+	if(rpm == 0){
+		aplicaDuty(0);
+	}
+}
+
+/*
+ * Chamado periodicamente (100 ms): verifica o travamento e corrige o
+ * duty cycle pelo PI incremental. O duty cycle resultante passa pela
+ * rampa, que limita a taxa de variacao.
+ */
+void Ventilador::controla(){
+	int32_t erro;
+
+	if(tacometro == 0 || ventiladorTravado){
+		return;
+	}
+	if(dutyAplicado > 0 && tacometro->isStalled()){
+		ventiladorTravado = true;
+		rpmAlvo = 0;
+		aplicaDuty(0);
+		return;
+	}
+	if(rpmAlvo == 0){
+		return;
+	}
+	erro = (int32_t)rpmAlvo - tacometro->readRPM();
+	saidaPI += (erro - erroAnterior) * VENT_PI_KP + erro * VENT_PI_KI;
+	erroAnterior = erro;
+	if(saidaPI < 0){
+		saidaPI = 0;
+	} else if(saidaPI > ((int32_t)tetoDuty << VENT_PI_Q)){
+		saidaPI = (int32_t)tetoDuty << VENT_PI_Q;		//sem acumulo acima do teto
+	}
+	aplicaDuty(saidaPI >> VENT_PI_Q);
+}
+
+/*
+ * Rotacao medida (0 sem tacometro ou parado)
+ */
+uint16_t Ventilador::rotacao(){
+	if(tacometro == 0){
+		return 0;
+	}
+	return tacometro->readRPM();
+}
+
+bool Ventilador::travado(){
+	return ventiladorTravado;
+}
+
+/*
+ * Define o duty cycle de destino, em milesimos do periodo. A frequencia
+ * e ajustada uma unica vez e o contador nao para mais; chamadas repetidas
+ * com o mesmo valor (mantemVel a cada atualizacao) nao escrevem no TPM.
+ * O duty cycle e levado ao novo valor pela rampa, sem bloquear quem
+ * chamou.
+ */
+void Ventilador::aplicaDuty(uint16_t milesimos){
+	uint8_t i;
+
+	if(milesimos > tetoDuty){
+		milesimos = tetoDuty;
+	}
+	i = indicePerfil(milesimos);
+	if(milesimos == dutyAplicado){
+		return;
+	}
+	if(ventiladorTravado && milesimos != 0){
+		return;
+	}
+	if(tacometro != 0 && dutyAplicado <= 0 && milesimos != 0){
+		tacometro->restartStallTimer();		//partida: 0,9 s para girar
+	}
+	if(!pwmConfigurado){
+		//TPM0 compartilhado: o contador nao e parado por outros usuarios
+		if(!ventPwm.startShared(VENT_PWM_DIV, VENT_PWM_MOD, 0)){
+			return;
+		}
+		pwmConfigurado = true;
+	}
+
+	ventPwm.disableOverflowInterrupt();
+	alvo = (uint32_t)milesimos * VENT_DUTY_FATOR;
+	if(alvo > ((uint32_t)(VENT_PWM_MOD + 1) << VENT_RAMPA_Q)){
+		alvo = (uint32_t)(VENT_PWM_MOD + 1) << VENT_RAMPA_Q;
+	}
+	passo = (alvo > duty) ? passoSubida[i] : passoDescida[i];
+	periodosRampa = 0;
+	rampaAtiva = true;
+	ventPwm.enableOverflowInterrupt();
+	dutyAplicado = milesimos;
+}
+
+/*
+ * Rotacao mantida em malha fechada para a velocidade fixa
+ */
+uint16_t Ventilador::rotacaoVel(vel v){
+	switch(v){
 		case vel1:
-			ventPwm.setDutyCycle(vel1);
-			ventPwm.enableOperation();
-			break;
+			return VENT_RPM_VEL1;
 		case vel2:
-			ventPwm.setDutyCycle(vel2);
-			ventPwm.enableOperation();
-			break;
+			return VENT_RPM_VEL2;
 		case vel3:
-			ventPwm.setDutyCycle(vel3);
-			ventPwm.enableOperation();
-			break;
+			return VENT_RPM_VEL3;
+		default:
+			return 0;
+	}
+}
 
+/*
+ * Perfil de rampa: o da maior velocidade fixa que nao excede o destino
+ */
+uint8_t Ventilador::indicePerfil(uint16_t milesimos){
+	if(milesimos >= vel3){
+		return 3;
 	}
+	if(milesimos >= vel2){
+		return 2;
+	}
+	if(milesimos >= vel1){
+		return 1;
+	}
+	return 0;
+}
 
+/*
+ * Passo Q16 por periodo do PWM para percorrer o periodo todo em ms
+ */
+uint32_t Ventilador::passoRampa(uint16_t ms){
+	uint32_t periodos = (uint32_t)ms * VENT_PWM_HZ / 1000;
 
+	if(periodos == 0){
+		return (uint32_t)(VENT_PWM_MOD + 1) << VENT_RAMPA_Q;
+	}
+	return ((uint32_t)(VENT_PWM_MOD + 1) << VENT_RAMPA_Q) / periodos;
 }
 
 //Essa funçao se colocada no loop da main irá sempre buscar se a tecla de aumento de velocidade foi pressionada para mudar a velocidade do controlador
 void Ventilador::aumentaVel(){//, mkl_RemoteControl rc){
 		selVel++;
-		if(selVel == 4) selVel = 1;
+		if(selVel > VENT_AUTOMATICO) selVel = 1;	//1, 2, 3, automatico
 		this->mantemVel();
 
 }
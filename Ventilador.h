@@ -12,6 +12,7 @@
 #include "mkl_TPMPulseWidthModulation.h"
 #include "mkl_RemoteControl.h"
 #include "mkl_TPM.h"
+#include "mkl_TPMTachometer.h"
 
 typedef enum {
   vel0 = 0,
@@ -21,8 +22,84 @@ typedef enum {
 
 }vel;
 
+/*
+ * Frequencia do PWM, acima da faixa audivel. O prescaler e o MOD sao
+ * escolhidos em tempo de compilacao: o menor divisor cujo MOD cabe em
+ * 16 bits, para a maior resolucao possivel.
+ */
+#define VENT_PWM_FREQ		25000		//Hz
+#define VENT_TPM_CLOCK		20971520
+#define VENT_PWM_DIV		ventDivisor(VENT_PWM_FREQ)
+#define VENT_PWM_MOD		ventModulo(VENT_PWM_FREQ)
+#define VENT_PWM_HZ			(VENT_TPM_CLOCK / (1u << VENT_PWM_DIV) / (VENT_PWM_MOD + 1))
+
+/*
+ * As velocidades (vel), o percentual e a saida do PI sao em milesimos do
+ * periodo, independentes do MOD; VENT_DUTY_FATOR converte para CnV em
+ * Q16 (arredondado para cima: 1000 milesimos chegam ao periodo todo)
+ */
+#define VENT_DUTY_ESCALA	1000
+#define VENT_DUTY_FATOR		((((uint32_t)(VENT_PWM_MOD + 1) << VENT_RAMPA_Q) + VENT_DUTY_ESCALA - 1) / VENT_DUTY_ESCALA)
+#define VENT_DUTY_FRACAO	((1u << VENT_RAMPA_Q) - 1)
+#define VENT_VELOCIDADES	4
+#define VENT_RAMPA_Q		16			//duty cycle em ponto fixo Q16
+#define VENT_AUTOMATICO		4			//selVel: velocidade pelo termostato
+
+/*
+ * Malha fechada de rotacao (com tacometro): rotacao de cada velocidade
+ * fixa e ganhos do PI incremental, em Q8, por chamada de controla()
+ */
+#define VENT_RPM_VEL1		1000
+#define VENT_RPM_VEL2		1600
+#define VENT_RPM_VEL3		2300
+#define VENT_PI_Q			8
+#define VENT_PI_KP			64			//0,25 milesimo por rpm
+#define VENT_PI_KI			16			//0,0625 milesimo por rpm
+
+constexpr tpm_Div ventDivisor(uint32_t hz, uint8_t div = tpm_div1) {
+	return (div >= tpm_div128 || VENT_TPM_CLOCK / (1u << div) / hz <= 0x10000) ?
+			(tpm_Div)div : ventDivisor(hz, div + 1);
+}
+
+constexpr uint16_t ventModulo(uint32_t hz) {
+	return (uint16_t)((VENT_TPM_CLOCK / (1u << ventDivisor(hz)) + hz / 2) / hz - 1);
+}
+
+static_assert(VENT_PWM_MOD >= 99, "frequencia do PWM do ventilador alta demais");
+
+/*
+ * Tempos de rampa, em ms, para a excursao completa do duty cycle (0 ao
+ * periodo todo). A rampa usa o perfil da velocidade de destino.
+ */
+typedef struct {
+	uint16_t subidaMs;
+	uint16_t descidaMs;
+} PerfilRampa;
 
 
+/*
+ * Ventilador com partida suave: selecionaVel apenas define o alvo; a
+ * interrupcao de estouro do TPM (uma vez por periodo do PWM) aproxima o
+ * duty cycle do alvo em passos de ponto fixo, conforme o perfil da
+ * velocidade, e se desabilita ao chega-lo. trataInterrupcao deve ser
+ * chamado no TPMx_IRQHandler do pino.
+ *
+ * O duty cycle e mantido em Q16 de CnV e a parte fracionaria e aplicada
+ * por sigma-delta de primeira ordem: a cada periodo o CnV alterna entre
+ * os dois valores vizinhos de forma que a media seja o valor pedido, o
+ * que compensa o MOD menor da frequencia alta. Enquanto houver fracao, a
+ * interrupcao de estouro continua habilitada.
+ *
+ * Alem das tres velocidades fixas, a velocidade pode ser qualquer
+ * percentual (ajustaPercentual); no modo automatico (selVel ==
+ * VENT_AUTOMATICO) o duty cycle segue o ControladorPID.
+ *
+ * Com um tacometro conectado, as velocidades fixas passam a ser rotacoes
+ * (VENT_RPM_VELx) mantidas por um PI chamado periodicamente em
+ * controla(), partindo do duty cycle nominal da velocidade. Se o
+ * ventilador acionado parar de gerar pulsos, e marcado como travado e
+ * desacionado ate o proximo desligaVel.
+ */
 class Ventilador {
 public:
 	Ventilador(tpm_Pin pin);
@@ -32,9 +109,52 @@ public:
 	void selecionaVel(vel v);
 	void aumentaVel();//, mkl_RemoteControl rc);
 	void diminuiVel();//, mkl_RemoteControl rc);
+	void ajustaPercentual(uint8_t percentual);
+	void ajustaMilesimos(uint16_t milesimos);
+	void acompanhaDemanda(uint16_t milesimos);
+	void limitaDuty(uint16_t milesimos);
+	void configuraRampa(vel v, uint16_t subidaMs, uint16_t descidaMs);
+	void trataInterrupcao();
+	bool emRampa();
+	uint16_t dutyAtual();
+	uint32_t tempoRampaMs();
+	void conectaTacometro(mkl_TPMTachometer *tacometro);
+	void ajustaRotacao(uint16_t rpm);
+	void controla();
+	uint16_t rotacao();
+	bool travado();
 	int selVel = 0;
 	mkl_TPMPulseWidthModulation ventPwm;
 
+private:
+	/*
+	 * Configuracao ja aplicada ao TPM: os registradores so sao escritos
+	 * quando a velocidade pedida muda
+	 */
+	int dutyAplicado = -1;
+	bool pwmConfigurado = false;
+	uint16_t tetoDuty = VENT_DUTY_ESCALA;
+
+	void aplicaDuty(uint16_t milesimos);
+	uint8_t indicePerfil(uint16_t milesimos);
+	uint16_t rotacaoVel(vel v);
+	uint32_t passoRampa(uint16_t ms);
+
+	uint32_t passoSubida[VENT_VELOCIDADES];		//Q16 por periodo
+	uint32_t passoDescida[VENT_VELOCIDADES];
+	volatile uint32_t duty = 0;					//Q16
+	volatile uint32_t alvo = 0;					//Q16
+	volatile uint32_t passo = 0;
+	volatile bool rampaAtiva = false;
+	volatile uint32_t periodosRampa = 0;
+	volatile uint32_t duracaoRampa = 0;			//periodos da ultima rampa
+	volatile uint32_t residuo = 0;				//acumulador do sigma-delta
+
+	mkl_TPMTachometer *tacometro = 0;
+	uint16_t rpmAlvo = 0;						//0: malha aberta
+	int32_t saidaPI = 0;						//milesimos em Q8
+	int32_t erroAnterior = 0;
+	bool ventiladorTravado = false;
 };
 
 #endif /* SOURCES_VENTILADOR_H_ */
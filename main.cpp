@@ -30,31 +30,116 @@
 //Include PWM
 #include "mkl_TPMPulseWidthModulation.h"
 #include "mkl_DHT11Sensor.h"
+//Include Controle Remoto e Registrador de Comandos
+#include "mkl_RemoteControl.h"
+#include "RegistradorComandos.h"
+//Include Servico de Botoes
+#include "mkl_GPIOInterrupt.h"
+#include "ServicoBotoes.h"
+#include "ReconhecedorGestos.h"
+#include "Relogio.h"
+#include "FilaEventos.h"
+#include "MapaPlaca.h"
+#include "Aleta.h"
+#include "Termostato.h"
+#include "ControladorPID.h"
+#include "Compressor.h"
+#include "PerfilSono.h"
+#include "Desumidificador.h"
 
 
-mkl_GPIOPort sleep_T(gpio_PTA1);
-mkl_GPIOPort rst_T(gpio_PTA2);
-mkl_GPIOPort b_onoff(gpio_PTD4);
-mkl_GPIOPort fan_T(gpio_PTA12);
+//Pinos e canais vem do mapa da placa (MapaPlaca.h), verificado na compilacao
+mkl_GPIOInterrupt sleep_T(PinoGpio<pl_botaoSleep>::pino);
+mkl_GPIOInterrupt rst_T(PinoGpio<pl_botaoReset>::pino);
+mkl_GPIOInterrupt b_onoff(PinoGpio<pl_botaoPower>::pino);
+mkl_GPIOInterrupt fan_T(PinoGpio<pl_botaoVentilador>::pino);
+FilaEventos fila;
+ServicoBotoes botoes;
+ReconhecedorGestos gestos(&fila);
+cmd_Acao acaoGesto[BOTOES_MAX][gs_gestos];
 
 
 Temporizador temp;
 MuxCanais mux;
-Ventilador vent(tpm_PTD3);
+Ventilador vent(PinoTpm<pl_ventilador>::pino);
+static_assert(PinoTpm<pl_ventilador>::divisor == VENT_PWM_DIV &&
+		PinoTpm<pl_ventilador>::modulo == VENT_PWM_MOD,
+		"PWM do ventilador diferente do mapa da placa");
 
-mkl_DHT11Sensor dht11(tpm_TPM1, gpio_PTC1);
+//TPM1 a 50 Hz dividido entre tacometro, aleta (servo) e DHT11
+mkl_TPMTachometer tacometro(PinoTpm<pl_tacometro>::pino, 2,
+		PinoTpm<pl_tacometro>::modulo);
+Aleta aleta(PinoTpm<pl_aleta>::pino);
+mkl_DHT11Sensor dht11(ContadorTpm<pl_dht11Tempo>::tpm,
+		PinoGpio<pl_dht11Dados>::pino, ContadorTpm<pl_dht11Tempo>::modulo);
 int temperatura;
 uint8_t umidade;
 dht11_Exception excecao;
+Termostato termostato;
+ControladorPID pid;
+PerfilSono sono;
+Desumidificador seco;
+bool modoSeco = false;
+uint16_t demandaVentilador = 0;		//milesimos, do PID no modo automatico
+static_assert(PID_SAIDA_MAX == VENT_DUTY_ESCALA,
+		"saida do PID diferente da escala do ventilador");
+Compressor compressor(PinoGpio<pl_compressor>::pino);
 
-mkl_PITInterruptInterrupt pit(PIT_Ch0);
-dsf_SerialDisplays disp(gpio_PTA13, gpio_PTD5, gpio_PTD0);
-mkl_TPMDelay tpm(tpm_TPM0);
-LigaDesliga ld(gpio_PTB19, gpio_PTD1);
+mkl_PITInterruptInterrupt pit(CanalPit<pl_tick>::canal);
+dsf_SerialDisplays disp(PinoGpio<pl_displayDados>::pino,
+		PinoGpio<pl_displayClock>::pino, PinoGpio<pl_displayLatch>::pino);
+LigaDesliga ld(PinoGpio<pl_ledTemporizador>::pino,
+		PinoGpio<pl_ledLigado>::pino);
+mkl_RemoteControl rc(PinoTpm<pl_receptorIR>::porta,
+		PinoTpm<pl_receptorIR>::pino);
+RegistradorComandos reg;
+
+uint8_t flag = 0;
+int setpoint = 24;
+bool bloqueioInfantil = false;
+bool modoServico = false;
+int botaoServico = -1;		//ultimo botao clicado no modo de servico
+bool aprendeu = false;
+
+/*
+ * Alarmes periodicos, verificados no tick do PIT e publicados como
+ * ev_alarme
+ */
+typedef enum {
+	alm_atualizacao = 0,	//atualiza leds, display e ventilador
+	alm_sensor,				//nova aquisicao do DHT11 (no maximo 1 Hz)
+	alm_controleRemoto,		//decodifica as bordas capturadas por DMA
+	alm_minuto,				//conta o temporizador e avanca o perfil do sleep
+	alm_total
+} alm_Alarme;
+
+/*
+ * O anel de bordas do DMA (IR_DMA_RING) guarda bem mais que as bordas
+ * de 20 ms de um quadro
+ */
+const uint16_t periodoAlarme[alm_total] = {
+	RELOGIO_MS(100),
+	RELOGIO_MS(2000),
+	RELOGIO_MS(20),
+	RELOGIO_MS(60000)
+};
+uint32_t prazoAlarme[alm_total];
+
+/*
+ * Latencia da publicacao ate o fim do tratamento, em ciclos do nucleo,
+ * por tipo de evento (consultada pelo depurador)
+ */
+uint32_t latenciaUltima[ev_tipos];
+uint32_t latenciaMaxima[ev_tipos];
+
+/*
+ * Ciclos do termostato e do PID na ultima leitura valida do sensor
+ */
+uint32_t ciclosControle;
 
 void setup_PIT() {
 	pit.enablePeripheralModule();
-	pit.setPeriod(0x4E20); 			//10 milisegundos
+	pit.setPeriod(RELOGIO_PIT_LDVAL);	//RELOGIO_TICK_MS (10 ms)
 	pit.resetCounter();
 	pit.enableTimer();
 	pit.enableInterruptRequests();
@@ -69,91 +154,435 @@ void setup_GPIO() {
 	b_onoff.setPullResistor(gpio_pullUpResistor);
 	fan_T.setPortMode(gpio_input);
 	fan_T.setPullResistor(gpio_pullUpResistor);
+
+	//Repiques de ate 3 ms rejeitados pelo filtro digital das portas A e D
+	rst_T.setDigitalFilter(3000);
+	sleep_T.setDigitalFilter(3000);
+	b_onoff.setDigitalFilter(3000);
+	fan_T.setDigitalFilter(3000);
+
+	/*
+	 * Gestos de cada botao: clique executa a acao do botao; segurar (com
+	 * repeticao) no ventilador/sleep ajusta o setpoint; duplo clique no
+	 * sleep alterna o modo da aleta e no ventilador, a velocidade da
+	 * varredura; duplo clique no reset inicia a sintonia do PID do
+	 * ventilador e no power alterna o modo seco; segurar o power alterna
+	 * a trava infantil e segurar o reset, o modo de servico
+	 */
+	uint8_t b;
+
+	b = botoes.adiciona(&sleep_T);
+	acaoGesto[b][gs_clique] = cmd_sleep;
+	acaoGesto[b][gs_duploClique] = cmd_swing;
+	acaoGesto[b][gs_longo] = cmd_setpointMenos;
+	acaoGesto[b][gs_repeticao] = cmd_setpointMenos;
+	gestos.configura(b, true);
+
+	b = botoes.adiciona(&rst_T);
+	acaoGesto[b][gs_clique] = cmd_reset;
+	acaoGesto[b][gs_duploClique] = cmd_sintonia;
+	acaoGesto[b][gs_longo] = cmd_servico;
+	gestos.configura(b, true);
+
+	b = botoes.adiciona(&b_onoff);
+	acaoGesto[b][gs_clique] = cmd_power;
+	acaoGesto[b][gs_duploClique] = cmd_seco;
+	acaoGesto[b][gs_longo] = cmd_bloqueio;
+	gestos.configura(b, true);
+
+	b = botoes.adiciona(&fan_T);
+	acaoGesto[b][gs_clique] = cmd_ventilador;
+	acaoGesto[b][gs_duploClique] = cmd_swingVelocidade;
+	acaoGesto[b][gs_longo] = cmd_setpointMais;
+	acaoGesto[b][gs_repeticao] = cmd_setpointMais;
+	gestos.configura(b, true);
+
+	botoes.conectaGestos(&gestos);
 }
 
-void DebounceReset(){
-	tpm.waitDelay(0x1332);//(0x1332);
+void acaoReset(){
 	temp.reset();
+	sono.encerra();
 }
 
-void DebounceSleep(){
-	tpm.waitDelay(0x1332);//(0x1332);
-	NVIC_DisableIRQ(PIT_IRQn);
+/*
+ * Cada toque avanca o temporizador e reinicia a contagem do minuto; o
+ * perfil do sleep comeca no primeiro e termina quando o temporizador
+ * volta a 0
+ */
+void acaoSleep(){
 	temp.sleep();
+	NVIC_DisableIRQ(PIT_IRQn);		//o prazo e atualizado no tick
+	prazoAlarme[alm_minuto] = Relogio::agora() + periodoAlarme[alm_minuto];
 	NVIC_EnableIRQ(PIT_IRQn);
-	ld.cont = 0;
+	if(temp.minutos() == 0){
+		sono.encerra();
+	} else if(!sono.ativo()){
+		sono.inicia();
+	}
+}
+
+void acaoVentilador(){
+	vent.aumentaVel();
 }
 
-void DebounceFan(){
-	tpm.waitDelay(0x1332);//(0x1332);
+void acaoPower(){
+	flag = ~flag;
 	vent.aumentaVel();
 }
 
+/*
+ * Setpoint do usuario mais o acrescimo do perfil do sleep
+ */
+void aplicaSetpoint(){
+	int16_t efetivo = setpoint * TERMO_ESCALA + sono.acrescimoSetpoint();
+
+	termostato.ajustaSetpoint(efetivo);
+	pid.ajustaSetpoint(efetivo);
+}
+
+void acaoSetpointMais(){
+	if(setpoint < 30) setpoint++;
+	aplicaSetpoint();
+}
+
+void acaoSetpointMenos(){
+	if(setpoint > 17) setpoint--;
+	aplicaSetpoint();
+}
+
+/*
+ * Sintonia por rele do PID: so faz sentido com o ventilador no modo
+ * automatico, que passa a ser o selecionado. No modo seco o PID nao
+ * roda e a sintonia nao avancaria: o comando e ignorado.
+ */
+void acaoSintonia(){
+	if(modoSeco){
+		return;
+	}
+	vent.selVel = VENT_AUTOMATICO;
+	pid.iniciaSintonia(demandaVentilador);
+}
+
+void acaoSwing(){
+	aleta.alternaModo();
+}
+
+void acaoSwingVelocidade(){
+	aleta.alternaVelocidade();
+}
+
+/*
+ * Modo seco: o PID do ventilador nao roda enquanto isso e recomeca do
+ * zero na volta
+ */
+void acaoSeco(){
+	modoSeco = !modoSeco;
+	pid.reinicia();
+}
+
+void acaoBloqueio(){
+	bloqueioInfantil = !bloqueioInfantil;
+}
+
+/*
+ * Modo de servico: um clique escolhe o botao e a proxima tecla do
+ * controle remoto e associada a acao de clique dele. Os vinculos sao
+ * gravados juntos na flash ao sair do modo.
+ */
+void acaoServico(){
+	modoServico = !modoServico;
+	botaoServico = -1;
+	if(!modoServico && aprendeu){
+		reg.gravaAprendidos();
+	}
+	aprendeu = false;
+}
+
+/*
+ * Tratadores indexados pela acao (cmd_Acao): controle remoto e botoes
+ * do painel passam pelo mesmo caminho de despacho
+ */
+typedef void (*TratadorAcao)();
+const TratadorAcao tratadores[cmd_total] = {
+	0,					//cmd_nenhum
+	acaoPower,			//cmd_power
+	acaoVentilador,		//cmd_ventilador
+	acaoSleep,			//cmd_sleep
+	acaoReset,			//cmd_reset
+	acaoSetpointMais,	//cmd_setpointMais
+	acaoSetpointMenos,	//cmd_setpointMenos
+	acaoBloqueio,		//cmd_bloqueio
+	acaoServico,		//cmd_servico
+	acaoSwing,			//cmd_swing
+	acaoSwingVelocidade,	//cmd_swingVelocidade
+	acaoSintonia,		//cmd_sintonia
+	acaoSeco			//cmd_seco
+};
+
+void despachaAcao(cmd_Acao acao){
+	if(acao >= cmd_total || tratadores[acao] == 0){
+		return;
+	}
+	if(!flag && acao != cmd_power && acao != cmd_bloqueio){	//Desligado: apenas power e trava
+		return;
+	}
+	tratadores[acao]();
+}
+
+/*
+ * Gestos dos botoes do painel. Com a trava infantil, apenas o gesto que
+ * a desfaz e aceito; no modo de servico, o clique so escolhe o botao a
+ * receber a proxima tecla do controle remoto.
+ */
+void trataGesto(const EventoGesto &evento){
+	cmd_Acao acao = acaoGesto[evento.botao][evento.gesto];
+
+	if(bloqueioInfantil && acao != cmd_bloqueio){
+		return;
+	}
+	if(modoServico && evento.gesto == gs_clique){
+		botaoServico = evento.botao;
+		return;
+	}
+	despachaAcao(acao);
+}
+
+void trataQuadro(const ir_Frame &quadro){
+	if(quadro.repeat){
+		return;
+	}
+	if(modoServico && botaoServico >= 0){
+		if(reg.aprende(quadro.protocol, quadro.address, quadro.command,
+				acaoGesto[botaoServico][gs_clique])){
+			aprendeu = true;
+		}
+		botaoServico = -1;
+		return;
+	}
+	reg.armazenaQuadro(quadro.protocol, quadro.address, quadro.command);
+	despachaAcao(reg.enviaComando(1));
+}
+
+/*
+ * Executa a aquisicao (bloqueante, ~25 ms) e publica o resultado
+ */
+void leSensor(){
+	Evento evento;
+
+	evento.tipo = ev_aquisicao;
+	evento.aquisicao.excecao = dht11.doAcquisition();
+	dht11.readTemperature(&evento.aquisicao.temperatura);
+	dht11.readUmidity(&evento.aquisicao.umidade);
+	fila.publica(&evento);
+}
+
+/*
+ * O termostato e o PID (ou, no modo seco, o desumidificador) rodam aqui,
+ * na taxa do sensor, com a temperatura e a umidade da mesma aquisicao;
+ * atualizaSaidas apenas aplica as saidas deles
+ */
+void trataAquisicao(const AquisicaoDHT11 &aquisicao){
+	uint32_t inicio;
+
+	excecao = aquisicao.excecao;
+	if(excecao != dht11_ok){
+		termostato.falhaSensor();
+		return;		//mantem a ultima leitura valida
+	}
+	temperatura = aquisicao.temperatura;
+	umidade = aquisicao.umidade;
+	inicio = Relogio::ciclos();
+	aplicaSetpoint();
+	termostato.atualiza(temperatura * TERMO_ESCALA);
+	if(modoSeco){
+		seco.atualiza(temperatura, umidade, termostato.setpoint());
+	} else {
+		demandaVentilador = pid.atualiza(temperatura * TERMO_ESCALA,
+				termostato.ventilacao() * (VENT_DUTY_ESCALA / 100));
+	}
+	ciclosControle = Relogio::decorrido(inicio);
+}
+
+void atualizaSaidas(){
+	if(flag){
+		//novafuncao();
+		vent.limitaDuty(sono.tetoVentilador());
+		if(modoSeco){
+			vent.ajustaMilesimos(seco.ventilacao());
+		} else {
+			vent.mantemVel();
+			vent.acompanhaDemanda(demandaVentilador);
+		}
+		vent.controla();
+		if(vent.travado()){
+			compressor.para();		//sem fluxo de ar: para ja
+		} else {
+			compressor.atualiza(modoSeco ? seco.compressor() :
+					termostato.compressor());
+		}
+		aleta.abre();
+		ld.Liga(temp.minutos(), flag, temp.ledTmrOn());
+		//no modo seco, mostra a sensacao termica no lugar da temperatura
+		int mostra = ld.tempo + (modoSeco ? (seco.sensacao() + 5) / 10 :
+				temperatura);
+		if(compressor.bloqueado() && !compressor.ligado()){
+			mostra = compressor.bloqueioSegundos();	//espera para religar
+		}
+		disp.writeWord(mostra);
+		if(temp.disable()){
+			flag = false;
+		}
+	} else {
+		ld.Desliga();
+		temp.reset();
+		sono.encerra();
+		compressor.atualiza(false);		//respeita o tempo minimo ligado
+		if(compressor.ligado()){		//mantem o fluxo de ar ate parar
+			vent.controla();
+			if(vent.travado()){
+				compressor.para();
+			}
+		} else {
+			vent.desligaVel();
+		}
+		aleta.fecha();
+		disp.clearDisplays();
+	}
+}
+
+/*
+ * Decodifica, no laco principal, as bordas capturadas por DMA e publica
+ * o quadro pronto; ele e tratado na mesma passada da fila
+ */
+void leControleRemoto(){
+	Evento evento;
+
+	if(rc.frameAvailable()){
+		evento.tipo = ev_quadroIR;
+		evento.quadro = rc.readFrame();
+		fila.publica(&evento);
+	}
+}
+
+void trataAlarme(uint8_t alarme){
+	switch(alarme){
+	case alm_atualizacao:
+		atualizaSaidas();
+		break;
+	case alm_sensor:
+		leSensor();
+		break;
+	case alm_controleRemoto:
+		leControleRemoto();
+		break;
+	case alm_minuto:
+		temp.decrementa();
+		sono.avancaMinuto();
+		break;
+	}
+}
+
+/*
+ * Ponto unico de tratamento das entradas. Gestos e quadros atualizam as
+ * saidas em seguida, de modo que a latencia medida vai da publicacao ate
+ * a acao visivel.
+ */
+void trataEvento(const Evento &evento){
+	switch(evento.tipo){
+	case ev_gesto:
+		trataGesto(evento.gesto);
+		atualizaSaidas();
+		break;
+	case ev_quadroIR:
+		trataQuadro(evento.quadro);
+		atualizaSaidas();
+		break;
+	case ev_aquisicao:
+		trataAquisicao(evento.aquisicao);
+		break;
+	case ev_alarme:
+		trataAlarme(evento.alarme);
+		break;
+	default:
+		return;
+	}
+	latenciaUltima[evento.tipo] = Relogio::decorrido(evento.ciclo);
+	if(latenciaUltima[evento.tipo] > latenciaMaxima[evento.tipo]){
+		latenciaMaxima[evento.tipo] = latenciaUltima[evento.tipo];
+	}
+}
+
+/*
+ * Chamado no tick: apenas publica os alarmes vencidos, com trabalho
+ * limitado; a decodificacao do controle remoto fica no laco principal
+ */
+void publicaAlarmes(){
+	Evento evento;
+	uint8_t i;
+
+	for(i = 0; i < alm_total; i++){
+		if(Relogio::passou(prazoAlarme[i])){
+			prazoAlarme[i] += periodoAlarme[i];
+			evento.tipo = ev_alarme;
+			evento.alarme = i;
+			fila.publica(&evento);
+		}
+	}
+}
+
 extern "C" {
+  void PORTA_IRQHandler(void) {
+	  botoes.trataInterrupcao();
+  }
+
+  void PORTD_IRQHandler(void) {
+	  botoes.trataInterrupcao();
+  }
+
+  void TPM0_IRQHandler(void) {
+	  vent.trataInterrupcao();
+  }
+
+  void TPM1_IRQHandler(void) {
+	  aleta.trataInterrupcao();		//antes do tacometro, que limpa TOF
+	  tacometro.handleInterrupt();
+  }
+
   void PIT_IRQHandler(void) {
 	  disp.updateDisplays();
 	 // disp.hideZerosRight();
 	  disp.hideZerosLeft();
 	  pit.clearInterruptFlag();
-	  ld.cont++;
-	  if(ld.cont >= 500){
-		  temp.decrementa();
-		  ld.cont = 0;
-	  }
+	  Relogio::tick();
+	  botoes.tick();
+	  publicaAlarmes();
   }
 }
 
 int main() {
+	Evento evento;
+
+	Relogio::iniciaCiclos();
 	setup_PIT();
 	setup_GPIO();
-	mkl_DHT11Sensor dht11(tpm_TPM1, gpio_PTC1);
+	aplicaSetpoint();
+	tacometro.enable();
+	aleta.liga(PinoTpm<pl_aleta>::divisor, PinoTpm<pl_aleta>::modulo);
+	vent.conectaTacometro(&tacometro);
 
-	excecao = dht11.doAcquisition();
-	uint8_t flag = 0;
-	tpm.setFrequency(tpm_div128);
+	rc.enableDMACapture(ir_protocolAuto, CanalDma<pl_dmaReceptorIR>::canal);
+	reg.carregaAprendidos();
 	disp.clearDisplays();
 	temp.reset();
 	ld.min = temp.minutos();
 	ld.tem = 0;
+	leSensor();
 	while (1) {
-		excecao = dht11.doAcquisition();
-		dht11.readTemperature(&temperatura);
-		if(!b_onoff.readBit()){
-			while(!b_onoff.readBit()){}
-			tpm.waitDelay(0x1332);//(0x1332);
-			flag = ~flag;
-			//vent.selVel = 0;
-			vent.aumentaVel();
+		fila.aguarda();		//dorme ate o proximo evento
+		while(fila.retira(&evento)){
+			trataEvento(evento);
 		}
-
-		if(flag){
-			if(!rst_T.readBit()){
-				while(!rst_T.readBit()){}
-				DebounceReset();
-			}
-			if(!sleep_T.readBit()){
-				while(!sleep_T.readBit()){}
-				DebounceSleep();
-			}
-			if(!fan_T.readBit()){
-				while(!fan_T.readBit()){}
-				DebounceFan();
-			}
-			//novafuncao();
-			vent.mantemVel();
-			ld.Liga(temp.minutos(), flag, temp.ledTmrOn());
-			int mostra = ld.tempo + temperatura;
-			disp.writeWord(mostra);
-			if(temp.disable()){
-				flag = false;
-			}
-		} else {
-			ld.Desliga();
-			temp.reset();
-			vent.desligaVel();
-			disp.clearDisplays();
-		}
-
 	}
 
 	return 0;
@@ -57,7 +57,49 @@ mkl_DHT11Sensor::mkl_DHT11Sensor(tpm_TPMNumberMask TPMNumber,
   /*!
    * Ajusta a frequ�ncia de opera��o do TPM.
    */
-  tpm.setFrequency(tpm_div1);
+  setTiming(tpm_div1);
+}
+
+/*!
+ *  @fn       mkl_DHT11Sensor
+ *
+ *  @brief    Configura o sensor no contador compartilhado de um TPM.
+ *
+ *  O contador do TPM não é parado nem ocupa canal: as temporizações leem
+ *  o contador, com o prescaler 32 (1,53 us por contagem), o mesmo do
+ *  tacômetro e do servo, de modo que o TPM pode ser dividido com eles.
+ *  O período do contador (MOD + 1) deve passar de 3,1 ms (2048
+ *  contagens).
+ *
+ *  @param    TPMNumber - periférico TPM desejado para uso com o sensor.
+ *            pin - pino do GPIO desejado para uso com o sensor.
+ *            MODRegister - fundo de escala do contador compartilhado.
+ */
+mkl_DHT11Sensor::mkl_DHT11Sensor(tpm_TPMNumberMask TPMNumber, gpio_Pin pin,
+                                 uint16_t MODRegister)
+                                :tpm(TPMNumber, MODRegister),
+                                 gpio(pin) {
+  setTiming(tpm_div32);
+}
+
+/*!
+ *  @fn       setTiming
+ *
+ *  @brief    Ajusta o prescaler do TPM e converte os tempos do protocolo
+ *            em contagens.
+ *
+ *  Com 20,97 MHz e prescaler 2^divBase, 0xFFFF >> divBase contagens são
+ *  3,1 ms (limite de cada nível; 7 vezes no início, em '0') e
+ *  1000 >> divBase são 47,7 us ('1' antes da resposta e limiar entre os
+ *  bits '0', de 26 us, e '1', de 70 us). Com divBase = 0 os valores são
+ *  os da versão original.
+ *
+ *  @param    divBase - prescaler do TPM.
+ */
+void mkl_DHT11Sensor::setTiming(tpm_Div divBase) {
+  tpm.setFrequency(divBase);
+  timeoutTicks = (uint16_t)(0xFFFF >> divBase);
+  oneTicks = (uint16_t)(1000 >> divBase);
 }
 
 /*!
@@ -184,7 +226,7 @@ int mkl_DHT11Sensor::wait(int bit) {
   /*!
    * Inicia uma temporiza��o.
    */
-  tpm.startDelay(0xFFFF);
+  tpm.startDelay(timeoutTicks);
 
   /*!
    * Prende at� que o dado lido seja diferente daquele especificado
@@ -247,14 +289,14 @@ void mkl_DHT11Sensor::startCommunication() {
    */
   gpio.writeBit(0);
   for (i = 0; i < 7; i++) {
-    tpm.waitDelay(0xFFFF);
+    tpm.waitDelay(timeoutTicks);
   }
 
   /*!
    * Escreve '1' na sa�da do GPIO e aguarda 1 ms.
    */
   gpio.writeBit(1);
-  tpm.waitDelay(1000);
+  tpm.waitDelay(oneTicks);
 }
 
 /*!
@@ -304,7 +346,7 @@ dht11_Exception mkl_DHT11Sensor::readPackage(uint16_t time[40]) {
    */
   for (i = 0; i < 8; i++) {
     umidity = umidity << 1;
-    if (time[i] >= 1000) {
+    if (time[i] >= oneTicks) {
       umidity |= 1;
     }
   }
@@ -316,7 +358,7 @@ dht11_Exception mkl_DHT11Sensor::readPackage(uint16_t time[40]) {
    */
   for (i = 16; i < 24; i++) {
     temperature = temperature << 1;
-    if (time[i] >= 1000) {
+    if (time[i] >= oneTicks) {
       temperature |= 1;
     }
   }
@@ -329,7 +371,7 @@ dht11_Exception mkl_DHT11Sensor::readPackage(uint16_t time[40]) {
    */
   for (i = 32; i < 40; i++) {
     verifyByte = verifyByte << 1;
-    if (time[i] >= 1000) {
+    if (time[i] >= oneTicks) {
       verifyByte |= 1;
     }
   }
@@ -74,6 +74,8 @@ class mkl_DHT11Sensor {
    */
   mkl_DHT11Sensor(tpm_TPMNumberMask TPMNumber = tpm_TPM0,
                   gpio_Pin pin = gpio_PTA1);
+  mkl_DHT11Sensor(tpm_TPMNumberMask TPMNumber, gpio_Pin pin,
+                  uint16_t MODRegister);
   /*!
    * M�todo de aquisi��o de dados.
    */
@@ -100,6 +102,16 @@ class mkl_DHT11Sensor {
    */
   uint8_t umidity, temperature, verifyByte;
 
+  /*!
+   * Tempos do protocolo em contagens do TPM (dependem do prescaler).
+   */
+  uint16_t timeoutTicks, oneTicks;
+
+  /*!
+   * Método de ajuste do prescaler e dos tempos do protocolo.
+   */
+  void setTiming(tpm_Div divBase);
+
   /*!
    * M�todo de leitura do sensor.
    */
@@ -0,0 +1,190 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao da classe "mkl_DMA".
+ *
+ * @file        mkl_DMA.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_DMA.h"
+
+/*!
+ * Contagem de bytes carregada no BCR (mximo de 20 bits, par para
+ * transferncias de 16 bits).
+ */
+static const uint32_t dmaByteCount = 0xFFFFE;
+
+/*!
+ *   @fn         mkl_DMA
+ *
+ *   @brief      Associa o objeto ao canal e habilita os clocks do DMA e
+ *               do DMAMUX.
+ *
+ *   @param[in]  channel - canal do DMA (0 a 3).
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - SCGC6: System Clock Gating Control Register 6. Pg.207.
+ *               - SCGC7: System Clock Gating Control Register 7. Pg.209.
+ */
+mkl_DMA::mkl_DMA(dma_Channel channel) {
+  SIM_SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+  SIM_SCGC7 |= SIM_SCGC7_DMA_MASK;
+  bindChannel(channel);
+  ringBase = 0;
+  ringMask = 0;
+}
+
+mkl_DMA::mkl_DMA() {
+}
+
+/*!
+ *   @fn         bindChannel
+ *
+ *   @brief      Inicializa os ponteiros para os registradores do canal.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - DMA_SARn, DMA_DARn, DMA_DSR_BCRn, DMA_DCRn. Pg.358.
+ *               - DMAMUX_CHCFGn: Channel Configuration Register. Pg.327.
+ */
+void mkl_DMA::bindChannel(uint8_t channel) {
+  addressDMASARn = (volatile uint32_t *)(0x40008100 + 0x10*channel);
+  addressDMADARn = (volatile uint32_t *)(0x40008104 + 0x10*channel);
+  addressDMADSR_BCRn = (volatile uint32_t *)(0x40008108 + 0x10*channel);
+  addressDMADCRn = (volatile uint32_t *)(0x4000810C + 0x10*channel);
+  addressDMAMUXCHCFGn = (volatile uint8_t *)(0x40021000 + channel);
+}
+
+/*!
+ *   @fn         setRequestSource
+ *
+ *   @brief      Roteia a requisio do perifrico para o canal.
+ *
+ *   @param[in]  source - nmero da fonte no DMAMUX (ver dma_Source).
+ */
+void mkl_DMA::setRequestSource(uint8_t source) {
+  *addressDMAMUXCHCFGn = 0;
+  *addressDMAMUXCHCFGn = 0x80 | (source & 0x3F);
+}
+
+/*!
+ *   @fn         setupRing16
+ *
+ *   @brief      Programa transferncias de 16 bits de um registrador fixo
+ *               para um buffer circular.
+ *
+ *   @param[in]  source - registrador lido a cada requisio.
+ *               ring - buffer de destino, alinhado ao seu tamanho.
+ *               size - tamanho do buffer (16 << (size - 1) bytes).
+ *
+ *   @remarks    DCR: CS (um ciclo por requisio), SSIZE = DSIZE = 16
+ *               bits, DINC e DMOD. A requisio  ligada depois, por
+ *               enableRequests.
+ */
+void mkl_DMA::setupRing16(volatile uint32_t *source, uint16_t *ring,
+                          dma_RingSize size) {
+  disableRequests();
+  /*!
+   * Limpa DONE e eventuais erros de uma configurao anterior.
+   */
+  *addressDMADSR_BCRn = 1UL << 24;
+  *addressDMASARn = (uint32_t)source;
+  *addressDMADARn = (uint32_t)ring;
+  *addressDMADSR_BCRn = dmaByteCount;
+  *addressDMADCRn = (1UL << 29) | (2UL << 20) | (1UL << 19) | (2UL << 17)
+                    | ((uint32_t)size << 8);
+  ringBase = (uint32_t)ring;
+  ringMask = (16UL << (size - 1)) - 1;
+}
+
+/*!
+ *   @fn         enableRequests
+ *
+ *   @brief      Habilita as requisies do perifrico (ERQ).
+ */
+void mkl_DMA::enableRequests() {
+  *addressDMADCRn |= 1UL << 30;
+}
+
+/*!
+ *   @fn         disableRequests
+ *
+ *   @brief      Desabilita as requisies do perifrico (ERQ).
+ */
+void mkl_DMA::disableRequests() {
+  *addressDMADCRn &= ~(1UL << 30);
+}
+
+/*!
+ *   @fn         writeIndex
+ *
+ *   @brief      Posio (em palavras de 16 bits) da prxima escrita no
+ *               buffer circular.
+ */
+uint16_t mkl_DMA::writeIndex() {
+  return ((*addressDMADARn - ringBase) & ringMask) >> 1;
+}
+
+/*!
+ *   @fn         remainingBytes
+ *
+ *   @brief      Bytes restantes at o canal encerrar (campo BCR).
+ */
+uint32_t mkl_DMA::remainingBytes() {
+  return *addressDMADSR_BCRn & 0xFFFFF;
+}
+
+/*!
+ *   @fn         reloadByteCount
+ *
+ *   @brief      Recarrega o BCR, mantendo a captura contnua. Deve ser
+ *               chamado periodicamente (o BCR cheio dura 524287 palavras).
+ *               Se o canal chegou a encerrar, DONE  limpo antes.
+ */
+void mkl_DMA::reloadByteCount() {
+  if (*addressDMADSR_BCRn & (0xFUL << 24 | 0x7UL << 28)) {
+    *addressDMADSR_BCRn = 1UL << 24;
+  }
+  *addressDMADSR_BCRn = dmaByteCount;
+}
+
+/*!
+ *   @fn         hasError
+ *
+ *   @brief      Indica erro de configurao ou de barramento (CE/BES/BED).
+ */
+bool mkl_DMA::hasError() {
+  return (*addressDMADSR_BCRn & (0x7UL << 28)) != 0;
+}
@@ -0,0 +1,143 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe "mkl_DMA".
+ *
+ * @file        mkl_DMA.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_DMA_H_
+#define MKL_DMA_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+
+/*!
+ * Enum dos canais do controlador DMA.
+ */
+typedef enum {
+  dma_Ch0 = 0,
+  dma_Ch1,
+  dma_Ch2,
+  dma_Ch3
+} dma_Channel;
+
+/*!
+ * Enum do tamanho do buffer circular de destino (campo DMOD do DCR).
+ * O buffer deve estar alinhado ao seu tamanho.
+ */
+typedef enum {
+  dma_ring16 = 1,
+  dma_ring32,
+  dma_ring64,
+  dma_ring128,
+  dma_ring256,
+  dma_ring512,
+  dma_ring1k
+} dma_RingSize;
+
+/*!
+ * Fontes de requisio do DMAMUX usadas pelos drivers (KL25, Tabela 3-20).
+ */
+typedef enum {
+  dma_sourceTPM0Ch0 = 24,
+  dma_sourceTPM1Ch0 = 30,
+  dma_sourceTPM2Ch0 = 32,
+  dma_sourceTPM0Overflow = 54
+} dma_Source;
+
+/*!
+ *  @class    mkl_DMA.
+ *
+ *  @brief    A classe representa um canal do controlador DMA.
+ *
+ *  @details  Implementa a transferncia disparada por perifrico (via
+ *            DMAMUX) de um registrador de 16 bits para um buffer circular
+ *            em RAM. Cada requisio move uma palavra (cycle steal) e o
+ *            endereo de destino volta ao incio do buffer pelo mdulo
+ *            DMOD, sem interveno da CPU.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Captura contnua de um registrador em buffer circular.
+ *              +fn mkl_DMA dma(dma_Ch2);
+ *              +fn dma.setRequestSource(dma_sourceTPM2Ch0);
+ *              +fn dma.setupRing16(&TPM2_C0V, ring, dma_ring256);
+ *              +fn dma.enableRequests();
+ *              +fn dma.writeIndex();
+ */
+class mkl_DMA {
+ public:
+  /*!
+   * Mtodos construtores da classe.
+   */
+  explicit mkl_DMA(dma_Channel channel);
+  mkl_DMA();
+
+  /*!
+   * Mtodos de configurao do canal.
+   */
+  void setRequestSource(uint8_t source);
+  void setupRing16(volatile uint32_t *source, uint16_t *ring,
+                   dma_RingSize size);
+
+  /*!
+   * Mtodos de habilitao das requisies.
+   */
+  void enableRequests();
+  void disableRequests();
+
+  /*!
+   * Mtodos de acompanhamento da transferncia.
+   */
+  uint16_t writeIndex();
+  uint32_t remainingBytes();
+  void reloadByteCount();
+  bool hasError();
+
+ private:
+  void bindChannel(uint8_t channel);
+
+  volatile uint32_t *addressDMASARn;
+  volatile uint32_t *addressDMADARn;
+  volatile uint32_t *addressDMADSR_BCRn;
+  volatile uint32_t *addressDMADCRn;
+  volatile uint8_t *addressDMAMUXCHCFGn;
+  uint32_t ringBase;
+  uint32_t ringMask;
+};
+
+#endif  //  MKL_DMA_H_
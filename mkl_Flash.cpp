@@ -0,0 +1,237 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao da API em C++ do mdulo de memria flash (FTFA).
+ *
+ * @file        mkl_Flash.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include <stdint.h>
+#include "mkl_Flash.h"
+
+#ifndef FLASH_SIMULATED
+#include <MKL25Z4.h>
+#endif
+
+/*!
+ * Cdigos de comando do FTFA.
+ */
+static const uint8_t flashProgramLongword = 0x06;
+static const uint8_t flashEraseSector = 0x09;
+
+/*!
+ * Contador de apagamentos, para acompanhar o desgaste da flash.
+ */
+static uint32_t erases = 0;
+
+#ifdef FLASH_SIMULATED
+
+/*!
+ * Regio de RAM que substitui a flash na simulao.
+ */
+static uint32_t simulatedFlash[FLASH_SIM_SECTORS * FLASH_SECTOR_SIZE / 4] = {
+  0
+};
+static bool simulatedErased = false;
+
+static uint32_t *simulatedWord(uint32_t address) {
+  if (!simulatedErased) {
+    for (uint32_t i = 0; i < sizeof(simulatedFlash) / 4; i++) {
+      simulatedFlash[i] = FLASH_WORD_ERASED;
+    }
+    simulatedErased = true;
+  }
+  if (address < FLASH_SIM_BASE
+      || address >= FLASH_SIM_BASE + sizeof(simulatedFlash)) {
+    return 0;
+  }
+  return &simulatedFlash[(address - FLASH_SIM_BASE) / 4];
+}
+
+#else
+
+/*!
+ *   @fn         flash_launchCommand
+ *
+ *   @brief      Dispara o comando carregado nos registradores FCCOB e
+ *               aguarda o seu trmino.
+ *
+ *   Esta rotina  alocada na seo de dados (copiada para a RAM pelo
+ *   cdigo de inicializao), pois a flash fica inacessvel durante o
+ *   comando.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - FTFA_FSTAT: Flash Status Register. Pg. 446.
+ */
+__attribute__((section(".data.flash_launchCommand"), noinline, long_call))
+static uint8_t flash_launchCommand() {
+  FTFA_FSTAT = FTFA_FSTAT_CCIF_MASK;
+  while (!(FTFA_FSTAT & FTFA_FSTAT_CCIF_MASK)) {}
+  return FTFA_FSTAT;
+}
+
+#endif
+
+/*!
+ *   @fn         eraseSector
+ *
+ *   @brief      Apaga o setor de 1 KB que contm o endereo.
+ *
+ *   @param[in]  address - endereo dentro do setor.
+ *
+ *   @return     flash_ok ou o erro reportado pelo FTFA.
+ */
+flash_Exception mkl_Flash::eraseSector(uint32_t address) {
+  address &= ~(FLASH_SECTOR_SIZE - 1);
+  erases++;
+  return executeCommand(flashEraseSector, address, 0);
+}
+
+/*!
+ *   @fn         programLongword
+ *
+ *   @brief      Programa uma palavra de 32 bits.
+ *
+ *   @details    A palavra deve estar apagada (ou conter apenas bits que
+ *               continuam em '1' no novo valor); caso contrrio o valor
+ *               lido aps a programao difere e  retornado
+ *               flash_verifyError.
+ *
+ *   @param[in]  address - endereo alinhado em 4 bytes.
+ *               data - valor a programar.
+ */
+flash_Exception mkl_Flash::programLongword(uint32_t address, uint32_t data) {
+  flash_Exception status;
+
+  if (address & 0x3) {
+    return flash_accessError;
+  }
+  status = executeCommand(flashProgramLongword, address, data);
+  if (status == flash_ok && readLongword(address) != data) {
+    return flash_verifyError;
+  }
+  return status;
+}
+
+/*!
+ *   @fn         readLongword
+ *
+ *   @brief      L uma palavra de 32 bits da flash.
+ */
+uint32_t mkl_Flash::readLongword(uint32_t address) {
+#ifdef FLASH_SIMULATED
+  uint32_t *word = simulatedWord(address);
+
+  return word ? *word : FLASH_WORD_ERASED;
+#else
+  return *(volatile const uint32_t *)address;
+#endif
+}
+
+/*!
+ *   @fn         eraseCount
+ *
+ *   @brief      Retorna o nmero de apagamentos de setor realizados.
+ */
+uint32_t mkl_Flash::eraseCount() {
+  return erases;
+}
+
+/*!
+ *   @fn         executeCommand
+ *
+ *   @brief      Carrega e executa um comando do FTFA.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - FTFA_FCCOBn: Flash Common Command Object Registers.
+ *                 Pg. 449.
+ */
+flash_Exception mkl_Flash::executeCommand(uint8_t command, uint32_t address,
+                                          uint32_t data) {
+#ifdef FLASH_SIMULATED
+  uint32_t *word = simulatedWord(address);
+  uint32_t i;
+
+  if (!word) {
+    return flash_accessError;
+  }
+  if (command == flashEraseSector) {
+    for (i = 0; i < FLASH_SECTOR_SIZE / 4; i++) {
+      word[i] = FLASH_WORD_ERASED;
+    }
+  } else {
+    /*!
+     * A programao s leva bits de '1' para '0'.
+     */
+    *word &= data;
+  }
+  return flash_ok;
+#else
+  uint8_t status;
+  uint32_t primask;
+
+  /*!
+   * Aguarda comando anterior e limpa as flags de erro.
+   */
+  while (!(FTFA_FSTAT & FTFA_FSTAT_CCIF_MASK)) {}
+  FTFA_FSTAT = FTFA_FSTAT_ACCERR_MASK | FTFA_FSTAT_FPVIOL_MASK;
+
+  FTFA_FCCOB0 = command;
+  FTFA_FCCOB1 = (address >> 16) & 0xFF;
+  FTFA_FCCOB2 = (address >> 8) & 0xFF;
+  FTFA_FCCOB3 = address & 0xFF;
+  FTFA_FCCOB4 = (data >> 24) & 0xFF;
+  FTFA_FCCOB5 = (data >> 16) & 0xFF;
+  FTFA_FCCOB6 = (data >> 8) & 0xFF;
+  FTFA_FCCOB7 = data & 0xFF;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  status = flash_launchCommand();
+  __set_PRIMASK(primask);
+
+  if (status & FTFA_FSTAT_ACCERR_MASK) {
+    return flash_accessError;
+  }
+  if (status & FTFA_FSTAT_FPVIOL_MASK) {
+    return flash_protectionError;
+  }
+  if (status & FTFA_FSTAT_MGSTAT0_MASK) {
+    return flash_verifyError;
+  }
+  return flash_ok;
+#endif
+}
@@ -0,0 +1,117 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da API em C++ do mdulo de memria flash (FTFA).
+ *
+ * @file        mkl_Flash.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_FLASH_H_
+#define MKL_FLASH_H_
+
+#include <stdint.h>
+
+/*!
+ * Tamanho do setor apagvel e da palavra programvel da flash do KL25.
+ */
+#define FLASH_SECTOR_SIZE   1024UL
+#define FLASH_WORD_ERASED   0xFFFFFFFFUL
+
+/*!
+ * Com FLASH_SIMULATED definido, a flash  substituda por uma regio de
+ * RAM com as mesmas regras (apagamento por setor, programao apenas de
+ * '1' para '0'), permitindo testar em host o cdigo que a utiliza.
+ */
+#ifdef FLASH_SIMULATED
+#ifndef FLASH_SIM_BASE
+#define FLASH_SIM_BASE      0x0001F000UL
+#endif
+#ifndef FLASH_SIM_SECTORS
+#define FLASH_SIM_SECTORS   4
+#endif
+#endif
+
+/*!
+ * Enum de retorno das operaes na flash.
+ */
+typedef enum {
+  flash_ok = 0,
+  flash_accessError,
+  flash_protectionError,
+  flash_verifyError
+} flash_Exception;
+
+/*!
+ *  @class    mkl_Flash
+ *
+ *  @brief    A classe implementa o apagamento e a programao da flash
+ *            interna atravs do mdulo FTFA.
+ *
+ *  @details  O comando  disparado e aguardado por uma rotina executada
+ *            em RAM, com as interrupes desabilitadas, pois a flash no
+ *            pode ser lida enquanto  apagada ou programada.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Uso dos mtodos:
+ *              +fn eraseSector(0x1FC00);
+ *              +fn programLongword(0x1FC00, 0x12345678);
+ *              +fn readLongword(0x1FC00);
+ */
+class mkl_Flash {
+ public:
+  /*!
+   * Mtodos de escrita na flash.
+   */
+  flash_Exception eraseSector(uint32_t address);
+  flash_Exception programLongword(uint32_t address, uint32_t data);
+
+  /*!
+   * Mtodo de leitura da flash.
+   */
+  uint32_t readLongword(uint32_t address);
+
+  /*!
+   * Nmero de apagamentos realizados desde a inicializao.
+   */
+  uint32_t eraseCount();
+
+ private:
+  flash_Exception executeCommand(uint8_t command, uint32_t address,
+                                 uint32_t data);
+};
+
+#endif  //  MKL_FLASH_H_
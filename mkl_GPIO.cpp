@@ -66,6 +66,87 @@ void mkl_GPIO::setPortMode(gpio_PortMode mode) {
   }
 }
 
+/*!
+ *   @fn         setDigitalFilter
+ *
+ *   @brief      Habilita o filtro digital de glitches do pino.
+ *
+ *   Pulsos de largura até glitchMicros são absorvidos pelo filtro antes de
+ *   chegarem ao PDIR e à lógica de interrupção, de modo que repiques não
+ *   geram interrupções. Larguras até 1 us usam o clock do barramento
+ *   (21 ciclos de 48 ns); acima disso, o LPO de 1 kHz (passo de 1 ms, máximo
+ *   31 ms). Clock e largura são da porta: o último valor ajustado vale para
+ *   todos os pinos filtrados dela.
+ *
+ *   @param[in]  glitchMicros - maior largura de pulso rejeitada, em us.
+ *
+ *   @return     false se a porta não possui filtro (apenas A e D possuem)
+ *               ou se a largura excede 31 ms (limitada a 31 ms).
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - PORTx_DFER: Digital Filter Enable Register. Pág. 189.
+ *               - PORTx_DFCR: Digital Filter Clock Register. Pág. 189.
+ *               - PORTx_DFWR: Digital Filter Width Register. Pág. 190.
+ */
+bool mkl_GPIO::setDigitalFilter(uint32_t glitchMicros) {
+  uint32_t portBase = (uint32_t)addressPortxPCRn & ~0xFFF;
+  uint32_t port = (portBase - 0x40049000) >> 12;
+  volatile uint32_t *addressDFER = (volatile uint32_t *)(portBase + 0xC0);
+  volatile uint32_t *addressDFCR = (volatile uint32_t *)(portBase + 0xC4);
+  volatile uint32_t *addressDFWR = (volatile uint32_t *)(portBase + 0xC8);
+  uint32_t enabled;
+  uint32_t clockLPO;
+  uint32_t width;
+  bool inRange = true;
+
+  if (port != 0 && port != 3) {
+    return false;
+  }
+
+  /*!
+   * Largura em ciclos: clock do barramento (20,97 ciclos/us, em ponto
+   * fixo) ou LPO (1 ciclo/ms), arredondada para cima.
+   */
+  width = (glitchMicros <= 1) ? (glitchMicros * 21475 + 1023) >> 10 : 32;
+  clockLPO = 0;
+  if (width > 31) {
+    clockLPO = 1;
+    width = (glitchMicros + 999) / 1000;
+    if (width > 31) {
+      width = 31;
+      inRange = false;
+    }
+  }
+
+  /*!
+   * Clock e largura só podem ser alterados com o filtro desabilitado.
+   */
+  enabled = *addressDFER;
+  *addressDFER = 0;
+  *addressDFCR = clockLPO;
+  *addressDFWR = width;
+  *addressDFER = enabled | pinPort;
+  return inRange;
+}
+
+/*!
+ *   @fn         disableDigitalFilter
+ *
+ *   @brief      Desabilita o filtro digital do pino.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - PORTx_DFER: Digital Filter Enable Register. Pág. 189.
+ */
+void mkl_GPIO::disableDigitalFilter() {
+  uint32_t portBase = (uint32_t)addressPortxPCRn & ~0xFFF;
+  uint32_t port = (portBase - 0x40049000) >> 12;
+
+  if (port != 0 && port != 3) {
+    return;
+  }
+  *(volatile uint32_t *)(portBase + 0xC0) &= ~pinPort;
+}
+
 /*!
  *   @fn         setPullResistor
  *
@@ -204,7 +285,12 @@ void mkl_GPIO::bindPeripheral(uint8_t GPIONumber, uint8_t pinNumber) {
   addressPortxPCRn = (volatile uint32_t *)(0x40049000
                        + 0x1000*GPIONumber
                        + 4*pinNumber);
-  port_pcr_isfr = (volatile uint32_t *)(0x400490A0);
+  /*!
+   * Endereço do ISFR da porta do pino.
+   * addressPortxISFR = 0x40049000 (Base) + 0x1000*(0,1,2,3 ou 4) + 0xA0.
+   */
+  port_pcr_isfr = (volatile uint32_t *)(0x400490A0
+                    + 0x1000*GPIONumber);
 }
 
 /*!
@@ -252,5 +338,5 @@ void mkl_GPIO::setGPIOParameters(gpio_Pin pin, uint32_t &gpio,
                                      uint32_t &pinNumber) {
   pinNumber = pin & 0xFF;
   gpio = pin >> 8;
-  pinPort = 1 << pin;
+  pinPort = 1 << pinNumber;
 }
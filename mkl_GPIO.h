@@ -145,6 +145,9 @@ typedef enum {
  *             +fn setPullResistor(mkl_PullUp);
  *             +fn data = readBit();
  *
+ *            Filtro digital (portas A e D): pulsos de até 3 ms ignorados.
+ *             +fn setDigitalFilter(3000);
+ *
  *            Uso dos m�todos como porta de sa�da.
  *	           +fn setPortMode(PortMode_t::Output);
  *             +fn writeBit(data);
@@ -165,6 +168,11 @@ class mkl_GPIO {
    * M�todo de leitura do pino.
    */
   int readBit();
+  /*!
+   * Métodos do filtro digital de glitches (apenas portas A e D).
+   */
+  bool setDigitalFilter(uint32_t glitchMicros);
+  void disableDigitalFilter();
 
  protected:
   /*!
@@ -54,43 +54,94 @@
  *             - PortxPCRn: Pin Control Register.Pg. 183 (Mux) and 185 (Pull).
  */
 
-mkl_GPIOInterrupt::mkl_GPIOInterrupt(gpio_Name GPIOName, gpio_Pin pin){
-  pinPort = 1 << pin;
-  bindPeripheral(GPIOName, pin);
-  enableModuleClock(GPIOName);
+mkl_GPIOInterrupt::mkl_GPIOInterrupt(gpio_Pin pin){
+  uint32_t pinNumber;
+  uint32_t gpio;
+
+  setGPIOParameters(pin, gpio, pinNumber);
+  bindPeripheral(gpio, pinNumber);
+  enableModuleClock(gpio);
   selectMuxAlternative();
 }
 /*!
  *   @fn         clearInterruptFlag
  *
- *   @brief      Limpa a flag de interrupo
+ *   @brief      Limpa a flag de interrupo do pino
+ *
+ *   Escreve '1' no bit do pino no ISFR da porta (os demais pinos no so
+ *   afetados).
  *
  *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *                - PortxPCRn: Pin Control Register.Pg. 183(Mux) and 185(Pull).
+ *                - PORTx_ISFR: Interrupt Status Flag Register. Pg. 188.
  */
 void mkl_GPIOInterrupt::clearInterruptFlag(){
-  *port_pcr_isfr = 0x00000002;
+  *port_pcr_isfr = pinPort;
+}
+/*!
+ *   @fn         isInterruptFlagSet
+ *
+ *   @brief      Indica se o pino sinalizou a condio de interrupo
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *                - PORTx_ISFR: Interrupt Status Flag Register. Pg. 188.
+ */
+bool mkl_GPIOInterrupt::isInterruptFlagSet(){
+  return (*port_pcr_isfr & pinPort) != 0;
 }
 /*!
  *   @fn         enableInterrupt
  *
- *   @brief      habilita as interrupes das GPIOS para operar.
+ *   @brief      Habilita a interrupo do pino na condio indicada.
+ *
+ *   Ajusta o campo IRQC do PCR sem alterar mux e pull e sem escrever '1'
+ *   na flag ISF, limpa uma flag pendente e habilita o vetor da porta no
+ *   NVIC (apenas portas A e D).
+ *
+ *   @param[in]  mode - condio de interrupo (borda ou nvel).
  *
  *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - PortxPCRn: Pin Control Register.Pg. 183 (Mux) and 185 (Pull).
+ *               - PortxPCRn: Pin Control Register.Pg. 183 (IRQC e ISF).
+ *               - NVIC: Nested Vectored Interrupt Controller. Pg. 51.
  */
-void mkl_GPIOInterrupt::enableInterrupt(){
-  *addressPortxPCRn &= ~0xF0000;
-  *addressPortxPCRn |= 0xA0000;
+void mkl_GPIOInterrupt::enableInterrupt(gpio_InterruptMode mode){
+  uint32_t pcr = *addressPortxPCRn & ~(0x01000000 | 0x000F0000);
+  uint32_t port = ((uint32_t)addressPortxPCRn - 0x40049000) >> 12;
+
+  *addressPortxPCRn = pcr | ((uint32_t)mode << 16);
+  clearInterruptFlag();
+  if (port == 0) {
+    NVIC_EnableIRQ(PORTA_IRQn);
+  } else if (port == 3) {
+    NVIC_EnableIRQ(PORTD_IRQn);
+  }
 }
 /*!
  *   @fn         disableInterrupt
  *
- *   @brief      Desabilita as interrupes das GPIOS para pararem de funcionar.
+ *   @brief      Desabilita a interrupo do pino (IRQC = 0).
+ *
+ *   O vetor da porta no NVIC  mantido, pois pode servir a outros pinos.
  *
  *   @remarks    Sigla e pagina do Manual de Referencia KL25:
- *               - PortxPCRn: Pin Control Register.Pg. 183 (Mux) and 185 (Pull).
+ *               - PortxPCRn: Pin Control Register.Pg. 183 (IRQC e ISF).
  */
 void mkl_GPIOInterrupt::disableInterrupt(){
-  *addressPortxPCRn |= 0x00000;
+  *addressPortxPCRn &= ~(0x01000000 | 0x000F0000);
+  clearInterruptFlag();
+}
+/*!
+ *   @fn         pinMask
+ *
+ *   @brief      Mscara do pino nos registradores da porta (bit n = pino n).
+ */
+uint32_t mkl_GPIOInterrupt::pinMask(){
+  return pinPort;
+}
+/*!
+ *   @fn         portName
+ *
+ *   @brief      Porta do pino, obtida do endereo do PCR associado.
+ */
+gpio_Name mkl_GPIOInterrupt::portName(){
+  return (gpio_Name)((((uint32_t)addressPortxPCRn - 0x40049000) >> 12) << 8);
 }
@@ -44,6 +44,18 @@
 
 #include "mkl_GPIO.h"
 
+/*!
+ * Enum das condies de interrupo do pino (campo IRQC do PCR).
+ */
+typedef enum {
+  gpio_irqDisabled = 0x0,
+  gpio_irqLow = 0x8,
+  gpio_irqRising = 0x9,
+  gpio_irqFalling = 0xA,
+  gpio_irqBoth = 0xB,
+  gpio_irqHigh = 0xC
+}gpio_InterruptMode;
+
 /*!
  *  @class    mkl_GPIOInterrupt.
  *
@@ -51,21 +63,36 @@
  *
  *  @details  Esta classe  derivada da classe me "mkl_GPIO" e implementa
  *            o perifrico GPIO com o modo de operao com interrupo.
+ *            Apenas as portas A e D possuem vetor de interrupo no KL25
+ *            (PORTA_IRQHandler e PORTD_IRQHandler), compartilhado pelos
+ *            pinos da porta: a rotina deve testar isInterruptFlagSet de
+ *            cada pino e limpar a sua flag.
  *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Interrupo nas duas bordas.
+ *              +fn enableInterrupt(gpio_irqBoth);
+ *              +fn isInterruptFlagSet();  // na rotina PORTx_IRQHandler
+ *              +fn clearInterruptFlag();
  */
 class mkl_GPIOInterrupt: public mkl_GPIO {
  public:
   /*!
    * Construtor padro classe.
    */
-  explicit mkl_GPIOInterrupt(gpio_Name GPIOName = gpio_GPIOD,
-                             gpio_Pin pin = gpio_PTD1);
+  explicit mkl_GPIOInterrupt(gpio_Pin pin = gpio_PTD1);
   /*!
    * Mtodos que tratam da interrupo.
    */
   void clearInterruptFlag();
-  void enableInterrupt();
+  bool isInterruptFlagSet();
+  void enableInterrupt(gpio_InterruptMode mode = gpio_irqFalling);
   void disableInterrupt();
+  /*!
+   * Mtodos de identificao do pino na porta.
+   */
+  uint32_t pinMask();
+  gpio_Name portName();
 };
 
 #endif  //  MKL_GPIOPORTINTERRUPT_H_
@@ -0,0 +1,129 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Configurao de compilao dos decodificadores de controle remoto IR.
+ *
+ * @file        mkl_IRConfig.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRCONFIG_H_
+#define MKL_IRCONFIG_H_
+
+#include <stdint.h>
+
+/*!
+ * Seleo, em tempo de compilao, dos protocolos suportados.
+ * Protocolos desabilitados (valor 0) no so compilados, economizando flash.
+ * Os valores podem ser sobrescritos nas opes do compilador (-D).
+ */
+#ifndef IR_ENABLE_NEC
+#define IR_ENABLE_NEC   1
+#endif
+
+#ifndef IR_ENABLE_RC5
+#define IR_ENABLE_RC5   1
+#endif
+
+#ifndef IR_ENABLE_RC6
+#define IR_ENABLE_RC6   1
+#endif
+
+#ifndef IR_ENABLE_SONY
+#define IR_ENABLE_SONY  1
+#endif
+
+/*!
+ * Base de tempo dos decodificadores: o contador livre do TPM usado pelo
+ * receptor, com clock de 20.97 MHz dividido por IR_TPM_DIV.
+ */
+#define IR_TPM_CLOCK_HZ   20970000UL
+#define IR_TPM_DIV        128UL
+
+/*!
+ * Converte um tempo em microssegundos para ciclos da base de tempo.
+ * Usado apenas com constantes, sendo resolvido pelo compilador.
+ */
+#define IR_TICKS(us)  ((uint16_t)(((uint32_t)(us) \
+                        * (IR_TPM_CLOCK_HZ / IR_TPM_DIV)) / 1000000UL))
+
+/*!
+ * Intervalo em nvel de repouso a partir do qual o quadro  considerado
+ * encerrado (maior que qualquer intervalo interno dos protocolos).
+ */
+#define IR_IDLE_TICKS  IR_TICKS(10000)
+
+/*!
+ * Captura por DMA: nmero de instantes de borda do buffer circular
+ * (potncia de 2; 128 bordas cobrem quase dois quadros NEC). O buffer
+ * ocupa 2 * IR_DMA_RING bytes e IR_DMA_RING_SIZE  o campo DMOD
+ * correspondente.
+ */
+#define IR_DMA_RING       128
+#define IR_DMA_RING_SIZE  dma_ring256
+
+/*!
+ * Grupo de receptores no mesmo TPM: nmero mximo de receptores e janela
+ * em que quadros iguais recebidos por receptores diferentes so
+ * considerados o mesmo toque de tecla. A janela  menor que o perodo de
+ * repetio dos protocolos (NEC 108 ms, RC5 114 ms, Sony 45 ms entre
+ * quadros, mas 3 quadros por toque) e maior que a diferena de chegada
+ * entre receptores (alguns milissegundos).
+ */
+#define IR_MAX_RECEIVERS  3
+#define IR_DEDUP_TICKS    IR_TICKS(40000)
+
+/*!
+ * Transmissor: portadora gerada por PWM do TPM (clock sem diviso) com
+ * ciclo de trabalho de 1/3, valor usual dos LEDs de controle remoto.
+ */
+#ifndef IR_TX_CARRIER_HZ
+#define IR_TX_CARRIER_HZ   38000UL
+#endif
+
+#define IR_TX_CARRIER_MOD  ((uint16_t)(IR_TPM_CLOCK_HZ / IR_TX_CARRIER_HZ - 1))
+#define IR_TX_CARRIER_CNV  ((uint16_t)((IR_TX_CARRIER_MOD + 1) / 3))
+
+/*!
+ * Transmissor: as duraes das marcas e espaos so contadas pelo PIT,
+ * com clock do barramento. A converso de microssegundos para ciclos 
+ * feita em ponto fixo (fator escalado por 1024), sem diviso em tempo
+ * de execuo.
+ */
+#define IR_TX_BUS_CLOCK_HZ  20970000UL
+#define IR_TX_SCALE         ((IR_TX_BUS_CLOCK_HZ * 1024UL / 1000UL + 500UL) / 1000UL)
+#define IR_TX_COUNTS(us)    ((((uint32_t)(us)) * IR_TX_SCALE) >> 10)
+
+#endif  //  MKL_IRCONFIG_H_
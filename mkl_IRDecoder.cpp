@@ -0,0 +1,184 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do decodificador IR multiprotocolo.
+ *
+ * @file        mkl_IRDecoder.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRDecoder.h"
+
+/*!
+ *   @fn         mkl_IRDecoder
+ *
+ *   @brief      Construtor da classe.
+ *
+ *   @param[in]  protocol - protocolo fixo ou ir_protocolAuto para deteco
+ *                          automtica entre os protocolos compilados.
+ */
+mkl_IRDecoder::mkl_IRDecoder(ir_Protocol protocol) {
+  lastFrame.protocol = ir_protocolAuto;
+  lastFrame.address = 0;
+  lastFrame.command = 0;
+  lastFrame.toggle = 0;
+  lastFrame.repeat = 0;
+  setProtocol(protocol);
+}
+
+/*!
+ *   @fn         setProtocol
+ *
+ *   @brief      Seleciona o protocolo decodificado.
+ *
+ *   @details    Protocolos no compilados (IR_ENABLE_xxx igual a 0) nunca
+ *               produzem quadros.
+ */
+void mkl_IRDecoder::setProtocol(ir_Protocol protocol) {
+  this->protocol = protocol;
+  reset();
+}
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Descarta os quadros parciais de todos os protocolos.
+ */
+void mkl_IRDecoder::reset() {
+#if IR_ENABLE_NEC
+  nec.reset();
+#endif
+#if IR_ENABLE_RC5
+  rc5.reset();
+#endif
+#if IR_ENABLE_RC6
+  rc6.reset();
+#endif
+#if IR_ENABLE_SONY
+  sony.reset();
+#endif
+}
+
+/*!
+ *   @fn         feed
+ *
+ *   @brief      Entrega um intervalo a todas as mquinas de estado ativas.
+ *
+ *   @param[in]  mark - 1 se o intervalo encerrado foi de portadora presente.
+ *               ticks - durao do intervalo em ciclos da base de tempo.
+ *
+ *   @return     ir_frameReady quando algum protocolo completa um quadro.
+ *               Erros de protocolos individuais no so propagados, pois
+ *               na deteco automtica  normal que os demais rejeitem.
+ */
+ir_Status mkl_IRDecoder::feed(uint8_t mark, uint16_t ticks) {
+#if IR_ENABLE_NEC
+  if (isActive(ir_protocolNEC) && nec.feed(mark, ticks) == ir_frameReady) {
+    return accept(nec.frame());
+  }
+#endif
+#if IR_ENABLE_RC5
+  if (isActive(ir_protocolRC5) && rc5.feed(mark, ticks) == ir_frameReady) {
+    return accept(rc5.frame());
+  }
+#endif
+#if IR_ENABLE_RC6
+  if (isActive(ir_protocolRC6) && rc6.feed(mark, ticks) == ir_frameReady) {
+    return accept(rc6.frame());
+  }
+#endif
+#if IR_ENABLE_SONY
+  if (isActive(ir_protocolSony) && sony.feed(mark, ticks) == ir_frameReady) {
+    return accept(sony.frame());
+  }
+#endif
+  return ir_busy;
+}
+
+/*!
+ *   @fn         idle
+ *
+ *   @brief      Informa a todas as mquinas que a linha ficou em repouso,
+ *               encerrando os protocolos sem marca final (Sony).
+ */
+ir_Status mkl_IRDecoder::idle() {
+  ir_Status status = ir_busy;
+
+#if IR_ENABLE_NEC
+  nec.idle();
+#endif
+#if IR_ENABLE_RC5
+  rc5.idle();
+#endif
+#if IR_ENABLE_RC6
+  rc6.idle();
+#endif
+#if IR_ENABLE_SONY
+  if (isActive(ir_protocolSony) && sony.idle() == ir_frameReady) {
+    status = accept(sony.frame());
+  }
+#endif
+  return status;
+}
+
+/*!
+ *   @fn         frame
+ *
+ *   @brief      Retorna o ltimo quadro aceito.
+ */
+const ir_Frame &mkl_IRDecoder::frame() const {
+  return lastFrame;
+}
+
+/*!
+ *   @fn         accept
+ *
+ *   @brief      Armazena o quadro completo e descarta os quadros parciais
+ *               dos demais protocolos.
+ */
+ir_Status mkl_IRDecoder::accept(const ir_Frame &decoded) {
+  lastFrame = decoded;
+  reset();
+  return ir_frameReady;
+}
+
+/*!
+ *   @fn         isActive
+ *
+ *   @brief      Indica se o protocolo participa da decodificao.
+ */
+bool mkl_IRDecoder::isActive(ir_Protocol candidate) const {
+  return protocol == ir_protocolAuto || protocol == candidate;
+}
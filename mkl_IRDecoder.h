@@ -0,0 +1,124 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do decodificador IR multiprotocolo.
+ *
+ * @file        mkl_IRDecoder.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRDECODER_H_
+#define MKL_IRDECODER_H_
+
+#include <stdint.h>
+#include "mkl_IRProtocol.h"
+
+#if IR_ENABLE_NEC
+#include "mkl_IRNecDecoder.h"
+#endif
+#if IR_ENABLE_RC5
+#include "mkl_IRRc5Decoder.h"
+#endif
+#if IR_ENABLE_RC6
+#include "mkl_IRRc6Decoder.h"
+#endif
+#if IR_ENABLE_SONY
+#include "mkl_IRSonyDecoder.h"
+#endif
+
+/*!
+ *  @class    mkl_IRDecoder
+ *
+ *  @brief    Decodificador IR multiprotocolo.
+ *
+ *  @details  Cada protocolo  uma mquina de estados alimentada pela mesma
+ *            sequncia de intervalos (marca/espao) medidos entre bordas.
+ *            No modo ir_protocolAuto todos os protocolos compilados
+ *            recebem cada intervalo em paralelo e o primeiro quadro
+ *            completo  aceito. Em modo fixo apenas um protocolo executa.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Uso a cada borda do receptor:
+ *              +fn setProtocol(ir_protocolAuto);
+ *              +fn if (feed(mark, ticks) == ir_frameReady) frame();
+ *              +fn idle();
+ */
+class mkl_IRDecoder {
+ public:
+  /*!
+   * Mtodo construtor padro da classe.
+   */
+  explicit mkl_IRDecoder(ir_Protocol protocol = ir_protocolAuto);
+
+  /*!
+   * Mtodos de configurao.
+   */
+  void setProtocol(ir_Protocol protocol);
+  void reset();
+
+  /*!
+   * Mtodos de alimentao das mquinas de estado.
+   */
+  ir_Status feed(uint8_t mark, uint16_t ticks);
+  ir_Status idle();
+
+  /*!
+   * Mtodo de leitura do ltimo quadro decodificado.
+   */
+  const ir_Frame &frame() const;
+
+ private:
+  ir_Status accept(const ir_Frame &decoded);
+  bool isActive(ir_Protocol candidate) const;
+
+  ir_Protocol protocol;
+  ir_Frame lastFrame;
+
+#if IR_ENABLE_NEC
+  mkl_IRNecDecoder nec;
+#endif
+#if IR_ENABLE_RC5
+  mkl_IRRc5Decoder rc5;
+#endif
+#if IR_ENABLE_RC6
+  mkl_IRRc6Decoder rc6;
+#endif
+#if IR_ENABLE_SONY
+  mkl_IRSonyDecoder sony;
+#endif
+};
+
+#endif  //  MKL_IRDECODER_H_
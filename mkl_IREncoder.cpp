@@ -0,0 +1,174 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do codificador IR (NEC e RC5).
+ *
+ * @file        mkl_IREncoder.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IREncoder.h"
+
+/*!
+ * Tempos nominais dos protocolos, em microssegundos.
+ */
+static const uint16_t necLeaderMark = 9000;
+static const uint16_t necLeaderSpace = 4500;
+static const uint16_t necRepeatSpace = 2250;
+static const uint16_t necBitMark = 562;
+static const uint16_t necZeroSpace = 562;
+static const uint16_t necOneSpace = 1687;
+static const uint16_t rc5HalfBit = 889;
+
+/*!
+ *   @fn         encode
+ *
+ *   @brief      Codifica o quadro na tabela de marcas e espaos.
+ *
+ *   @param[in]  frame - quadro a transmitir.
+ *               burst - tabela de sada.
+ *
+ *   @return     false se o protocolo no  suportado pelo codificador.
+ */
+bool mkl_IREncoder::encode(const ir_Frame &frame, ir_Burst *burst) {
+  burst->length = 0;
+  switch (frame.protocol) {
+    case ir_protocolNEC:
+      encodeNec(frame, burst);
+      return true;
+    case ir_protocolRC5:
+      encodeRc5(frame, burst);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/*!
+ *   @fn         encodeNec
+ *
+ *   @brief      Codifica um quadro NEC (LSB primeiro).
+ *
+ *   @details    Endereos at 0xFF so enviados seguidos do complemento;
+ *               acima disso, como 16 bits (NEC estendido). Com o campo
+ *               repeat ativo gera apenas o cdigo de repetio.
+ */
+void mkl_IREncoder::encodeNec(const ir_Frame &frame, ir_Burst *burst) {
+  uint32_t data;
+  uint8_t i;
+
+  append(burst, 1, necLeaderMark);
+  if (frame.repeat) {
+    append(burst, 0, necRepeatSpace);
+    append(burst, 1, necBitMark);
+    return;
+  }
+  append(burst, 0, necLeaderSpace);
+
+  if (frame.address > 0xFF) {
+    data = frame.address;
+  } else {
+    data = frame.address | ((uint32_t)(~frame.address & 0xFF) << 8);
+  }
+  data |= (uint32_t)frame.command << 16;
+  data |= (uint32_t)(~frame.command & 0xFF) << 24;
+
+  for (i = 0; i < 32; i++) {
+    append(burst, 1, necBitMark);
+    append(burst, 0, (data & 1) ? necOneSpace : necZeroSpace);
+    data >>= 1;
+  }
+  append(burst, 1, necBitMark);
+}
+
+/*!
+ *   @fn         encodeRc5
+ *
+ *   @brief      Codifica um quadro RC5 (Manchester, MSB primeiro).
+ *
+ *   @details    Bit '1'  espao seguido de marca; bit '0', marca seguida
+ *               de espao. Meios-bits de mesmo nvel so unidos em um s
+ *               intervalo, o espao inicial se confunde com o repouso e o
+ *               espao final no  transmitido.
+ */
+void mkl_IREncoder::encodeRc5(const ir_Frame &frame, ir_Burst *burst) {
+  uint16_t bits;
+  int8_t i;
+  uint8_t bit;
+
+  bits = 1 << 13;
+  bits |= (uint16_t)(!(frame.command & 0x40)) << 12;
+  bits |= (uint16_t)(frame.toggle & 1) << 11;
+  bits |= (uint16_t)(frame.address & 0x1F) << 6;
+  bits |= frame.command & 0x3F;
+
+  for (i = 13; i >= 0; i--) {
+    bit = (bits >> i) & 1;
+    append(burst, !bit, rc5HalfBit);
+    append(burst, bit, rc5HalfBit);
+  }
+  if ((burst->length & 1) == 0) {
+    burst->length--;
+  }
+}
+
+/*!
+ *   @fn         append
+ *
+ *   @brief      Acrescenta um intervalo  tabela.
+ *
+ *   @details    Intervalos de mesmo nvel do anterior so somados a ele;
+ *               espaos antes da primeira marca so descartados. Assim a
+ *               tabela mantm a alternncia marca/espao.
+ */
+void mkl_IREncoder::append(ir_Burst *burst, uint8_t mark, uint16_t us) {
+  uint8_t last = burst->length;
+
+  if (last == 0) {
+    if (mark) {
+      burst->us[0] = us;
+      burst->length = 1;
+    }
+    return;
+  }
+  if (((last - 1) & 1) == !mark) {
+    burst->us[last - 1] += us;
+    return;
+  }
+  if (last < IR_BURST_MAX) {
+    burst->us[last] = us;
+    burst->length = last + 1;
+  }
+}
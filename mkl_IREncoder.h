@@ -0,0 +1,92 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do codificador IR (NEC e RC5).
+ *
+ * @file        mkl_IREncoder.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRENCODER_H_
+#define MKL_IRENCODER_H_
+
+#include <stdint.h>
+#include "mkl_IRProtocol.h"
+
+/*!
+ * Nmero mximo de intervalos de uma rajada (quadro NEC completo: marca e
+ * espao de incio, 32 bits e marca final = 67 intervalos).
+ */
+#define IR_BURST_MAX  68
+
+/*!
+ * Rajada a transmitir: duraes em microssegundos, alternando marca
+ * (portadora presente) e espao, sempre comeando por uma marca.
+ */
+typedef struct {
+  uint16_t us[IR_BURST_MAX];
+  uint8_t length;
+} ir_Burst;
+
+/*!
+ *  @class    mkl_IREncoder.
+ *
+ *  @brief    Codificador de quadros IR em tabelas de marcas e espaos.
+ *
+ *  @details  Gera, a partir de um ir_Frame, a tabela de tempos usada pelo
+ *            transmissor. Os tempos so os nominais dos decodificadores,
+ *            de modo que um quadro codificado  aceito pelo receptor.
+ *            Suporta NEC (endereo de 8 ou 16 bits e repetio) e RC5
+ *            (incluindo o stimo bit de comando do RC5 estendido).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Codificao de um comando NEC.
+ *              +fn mkl_IREncoder::encode(frame, &burst);
+ */
+class mkl_IREncoder {
+ public:
+  /*!
+   * Codifica o quadro; retorna false se o protocolo no  suportado.
+   */
+  static bool encode(const ir_Frame &frame, ir_Burst *burst);
+
+ private:
+  static void encodeNec(const ir_Frame &frame, ir_Burst *burst);
+  static void encodeRc5(const ir_Frame &frame, ir_Burst *burst);
+  static void append(ir_Burst *burst, uint8_t mark, uint16_t us);
+};
+
+#endif  //  MKL_IRENCODER_H_
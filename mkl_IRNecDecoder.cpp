@@ -0,0 +1,218 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do decodificador do protocolo IR NEC.
+ *
+ * @file        mkl_IRNecDecoder.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRConfig.h"
+
+#if IR_ENABLE_NEC
+
+#include "mkl_IRNecDecoder.h"
+
+/*!
+ * Tempos nominais do protocolo, em ciclos da base de tempo.
+ */
+static const uint16_t necLeaderMark = IR_TICKS(9000);
+static const uint16_t necLeaderSpace = IR_TICKS(4500);
+static const uint16_t necRepeatSpace = IR_TICKS(2250);
+static const uint16_t necBitMark = IR_TICKS(562);
+static const uint16_t necZeroSpace = IR_TICKS(562);
+static const uint16_t necOneSpace = IR_TICKS(1687);
+
+/*!
+ *   @fn         mkl_IRNecDecoder
+ *
+ *   @brief      Construtor da classe, inicia a mquina em repouso.
+ */
+mkl_IRNecDecoder::mkl_IRNecDecoder() {
+  hasFrame = false;
+  reset();
+}
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Descarta o quadro parcial e volta ao estado de repouso.
+ */
+void mkl_IRNecDecoder::reset() {
+  state = nec_idle;
+  data = 0;
+  bits = 0;
+}
+
+/*!
+ *   @fn         feed
+ *
+ *   @brief      Processa um intervalo entre duas bordas do receptor.
+ *
+ *   @param[in]  mark - 1 se o intervalo encerrado foi de portadora presente.
+ *               ticks - durao do intervalo em ciclos da base de tempo.
+ *
+ *   @return     ir_frameReady ao completar um quadro (ou repetio),
+ *               ir_error se o intervalo no pertence ao protocolo e
+ *               ir_busy nos demais casos.
+ */
+ir_Status mkl_IRNecDecoder::feed(uint8_t mark, uint16_t ticks) {
+  switch (state) {
+    case nec_idle:
+      if (mark && ir_match(ticks, necLeaderMark)) {
+        state = nec_leaderSpace;
+      }
+      return ir_busy;
+
+    case nec_leaderSpace:
+      if (!mark && ir_match(ticks, necLeaderSpace)) {
+        data = 0;
+        bits = 0;
+        state = nec_bitMark;
+        return ir_busy;
+      }
+      if (!mark && ir_match(ticks, necRepeatSpace)) {
+        state = nec_repeatMark;
+        return ir_busy;
+      }
+      return fail(mark, ticks);
+
+    case nec_bitMark:
+      if (mark && ir_match(ticks, necBitMark)) {
+        state = nec_bitSpace;
+        return ir_busy;
+      }
+      return fail(mark, ticks);
+
+    case nec_bitSpace:
+      if (mark) {
+        return fail(mark, ticks);
+      }
+      if (ir_match(ticks, necOneSpace)) {
+        data |= (uint32_t)1 << bits;
+      } else if (!ir_match(ticks, necZeroSpace)) {
+        return fail(mark, ticks);
+      }
+      bits++;
+      state = (bits == 32) ? nec_stopMark : nec_bitMark;
+      return ir_busy;
+
+    case nec_stopMark:
+      if (mark && ir_match(ticks, necBitMark)) {
+        return finish();
+      }
+      return fail(mark, ticks);
+
+    case nec_repeatMark:
+      if (mark && ir_match(ticks, necBitMark) && hasFrame) {
+        state = nec_idle;
+        result.repeat = 1;
+        return ir_frameReady;
+      }
+      return fail(mark, ticks);
+  }
+  return fail(mark, ticks);
+}
+
+/*!
+ *   @fn         idle
+ *
+ *   @brief      Informa que a linha ficou em repouso; o NEC  encerrado
+ *               pela marca final, ento apenas descarta quadros parciais.
+ */
+ir_Status mkl_IRNecDecoder::idle() {
+  if (state == nec_idle) {
+    return ir_busy;
+  }
+  reset();
+  return ir_error;
+}
+
+/*!
+ *   @fn         frame
+ *
+ *   @brief      Retorna o ltimo quadro decodificado.
+ */
+const ir_Frame &mkl_IRNecDecoder::frame() const {
+  return result;
+}
+
+/*!
+ *   @fn         fail
+ *
+ *   @brief      Descarta o quadro parcial. Se o intervalo rejeitado for
+ *               uma marca de incio, a decodificao recomea por ela.
+ */
+ir_Status mkl_IRNecDecoder::fail(uint8_t mark, uint16_t ticks) {
+  reset();
+  if (mark && ir_match(ticks, necLeaderMark)) {
+    state = nec_leaderSpace;
+  }
+  return ir_error;
+}
+
+/*!
+ *   @fn         finish
+ *
+ *   @brief      Valida os bytes complementares e monta o quadro.
+ *
+ *   @details    O comando deve vir seguido do seu complemento. O endereo
+ *                de 8 bits quando seguido do complemento e de 16 bits
+ *               (NEC estendido) caso contrrio.
+ */
+ir_Status mkl_IRNecDecoder::finish() {
+  uint8_t address = data & 0xFF;
+  uint8_t addressInv = (data >> 8) & 0xFF;
+  uint8_t command = (data >> 16) & 0xFF;
+  uint8_t commandInv = (data >> 24) & 0xFF;
+
+  state = nec_idle;
+  if ((command ^ commandInv) != 0xFF) {
+    return ir_error;
+  }
+  result.protocol = ir_protocolNEC;
+  if ((address ^ addressInv) == 0xFF) {
+    result.address = address;
+  } else {
+    result.address = data & 0xFFFF;
+  }
+  result.command = command;
+  result.toggle = 0;
+  result.repeat = 0;
+  hasFrame = true;
+  return ir_frameReady;
+}
+
+#endif  //  IR_ENABLE_NEC
@@ -0,0 +1,87 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do decodificador do protocolo IR NEC.
+ *
+ * @file        mkl_IRNecDecoder.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRNECDECODER_H_
+#define MKL_IRNECDECODER_H_
+
+#include <stdint.h>
+#include "mkl_IRProtocol.h"
+
+/*!
+ *  @class    mkl_IRNecDecoder
+ *
+ *  @brief    Mquina de estados do protocolo NEC (distncia de pulso).
+ *
+ *  @details  Quadro: marca de 9 ms, espao de 4,5 ms, 32 bits com LSB
+ *            primeiro (endereo, ~endereo, comando, ~comando) e marca
+ *            final. Cada bit  uma marca de 562 us seguida de um espao
+ *            de 562 us (bit 0) ou 1687 us (bit 1). O cdigo de repetio
+ *             uma marca de 9 ms seguida de um espao de 2,25 ms.
+ */
+class mkl_IRNecDecoder {
+ public:
+  mkl_IRNecDecoder();
+  void reset();
+  ir_Status feed(uint8_t mark, uint16_t ticks);
+  ir_Status idle();
+  const ir_Frame &frame() const;
+
+ private:
+  typedef enum {
+    nec_idle = 0,
+    nec_leaderSpace,
+    nec_bitMark,
+    nec_bitSpace,
+    nec_stopMark,
+    nec_repeatMark
+  } nec_State;
+
+  ir_Status fail(uint8_t mark, uint16_t ticks);
+  ir_Status finish();
+
+  nec_State state;
+  uint32_t data;
+  uint8_t bits;
+  bool hasFrame;
+  ir_Frame result;
+};
+
+#endif  //  MKL_IRNECDECODER_H_
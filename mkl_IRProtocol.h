@@ -0,0 +1,116 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Tipos comuns aos decodificadores de controle remoto IR.
+ *
+ * @file        mkl_IRProtocol.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRPROTOCOL_H_
+#define MKL_IRPROTOCOL_H_
+
+#include <stdint.h>
+#include "mkl_IRConfig.h"
+
+/*!
+ * Enum dos protocolos de controle remoto.
+ */
+typedef enum {
+  ir_protocolAuto = 0,
+  ir_protocolNEC,
+  ir_protocolRC5,
+  ir_protocolRC6,
+  ir_protocolSony
+} ir_Protocol;
+
+/*!
+ * Enum de retorno dos decodificadores a cada intervalo recebido.
+ */
+typedef enum {
+  ir_busy = 0,
+  ir_frameReady,
+  ir_error
+} ir_Status;
+
+/*!
+ * Quadro decodificado, comum a todos os protocolos.
+ */
+typedef struct {
+  ir_Protocol protocol;
+  uint16_t address;
+  uint8_t command;
+  uint8_t toggle;
+  uint8_t repeat;
+} ir_Frame;
+
+/*!
+ *   @fn         ir_match
+ *
+ *   @brief      Verifica se um intervalo est a 25% do valor nominal.
+ *
+ *   @param[in]  ticks - durao medida do intervalo.
+ *               nominal - durao nominal (constante de compilao).
+ */
+inline bool ir_match(uint16_t ticks, uint16_t nominal) {
+  return ticks >= nominal - (nominal >> 2) && ticks <= nominal + (nominal >> 2);
+}
+
+/*!
+ *   @fn         ir_units
+ *
+ *   @brief      Quantiza um intervalo em mltiplos da unidade do protocolo.
+ *
+ *   O intervalo deve estar a 1/3 de unidade de um mltiplo inteiro; a
+ *   tolerncia  calculada sem diviso (o Cortex-M0+ no possui instruo
+ *   de diviso).
+ *
+ *   @return     nmero de unidades (1 a maxUnits) ou 0 se fora da faixa.
+ */
+inline uint8_t ir_units(uint16_t ticks, uint16_t unit, uint8_t maxUnits) {
+  uint16_t tolerance = (unit * 21) >> 6;
+  uint16_t nominal = unit;
+  uint8_t n;
+
+  for (n = 1; n <= maxUnits; n++) {
+    if (ticks >= nominal - tolerance && ticks <= nominal + tolerance) {
+      return n;
+    }
+    nominal += unit;
+  }
+  return 0;
+}
+
+#endif  //  MKL_IRPROTOCOL_H_
@@ -0,0 +1,195 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do decodificador do protocolo IR RC5.
+ *
+ * @file        mkl_IRRc5Decoder.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRConfig.h"
+
+#if IR_ENABLE_RC5
+
+#include "mkl_IRRc5Decoder.h"
+
+/*!
+ * Durao nominal do meio-bit e tamanho do quadro em meios-bits.
+ */
+static const uint16_t rc5HalfBit = IR_TICKS(889);
+static const uint16_t rc5Gap = IR_TICKS(2667);
+static const uint8_t rc5Halves = 28;
+
+/*!
+ *   @fn         mkl_IRRc5Decoder
+ *
+ *   @brief      Construtor da classe, inicia a mquina em repouso.
+ */
+mkl_IRRc5Decoder::mkl_IRRc5Decoder() {
+  armed = true;
+  reset();
+}
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Descarta o quadro parcial e volta ao estado de repouso.
+ */
+void mkl_IRRc5Decoder::reset() {
+  data = 0;
+  halves = 0;
+  firstHalf = 0;
+}
+
+/*!
+ *   @fn         feed
+ *
+ *   @brief      Processa um intervalo entre duas bordas do receptor.
+ *
+ *   @param[in]  mark - 1 se o intervalo encerrado foi de portadora presente.
+ *               ticks - durao do intervalo em ciclos da base de tempo.
+ */
+ir_Status mkl_IRRc5Decoder::feed(uint8_t mark, uint16_t ticks) {
+  uint8_t n = ir_units(ticks, rc5HalfBit, 2);
+
+  if (halves == 0) {
+    /*!
+     * Em repouso, o quadro comea pela marca do primeiro bit de incio,
+     * precedida do meio-bit de espao implcito e de repouso da linha.
+     */
+    if (!mark) {
+      if (ticks >= rc5Gap) {
+        armed = true;
+      }
+      return ir_busy;
+    }
+    if (!armed || n == 0) {
+      armed = false;
+      return ir_busy;
+    }
+    appendHalf(0);
+  } else if (n == 0) {
+    reset();
+    armed = !mark && ticks >= rc5Gap;
+    return ir_error;
+  }
+
+  while (n--) {
+    if (!appendHalf(mark)) {
+      reset();
+      armed = false;
+      return ir_error;
+    }
+  }
+
+  /*!
+   * Quadro terminado em bit '0': o ltimo meio-bit (espao) no gera borda.
+   */
+  if (halves == rc5Halves - 1 && mark) {
+    appendHalf(0);
+  }
+  if (halves == rc5Halves) {
+    return finish();
+  }
+  return ir_busy;
+}
+
+/*!
+ *   @fn         idle
+ *
+ *   @brief      Informa que a linha ficou em repouso, descartando
+ *               quadros incompletos.
+ */
+ir_Status mkl_IRRc5Decoder::idle() {
+  armed = true;
+  if (halves == 0) {
+    return ir_busy;
+  }
+  reset();
+  return ir_error;
+}
+
+/*!
+ *   @fn         frame
+ *
+ *   @brief      Retorna o ltimo quadro decodificado.
+ */
+const ir_Frame &mkl_IRRc5Decoder::frame() const {
+  return result;
+}
+
+/*!
+ *   @fn         appendHalf
+ *
+ *   @brief      Acrescenta um meio-bit. No segundo meio-bit de cada bit
+ *               verifica a transio Manchester e armazena o bit.
+ *
+ *   @return     false em violao da codificao Manchester.
+ */
+bool mkl_IRRc5Decoder::appendHalf(uint8_t level) {
+  if ((halves & 1) == 0) {
+    firstHalf = level;
+  } else {
+    if (firstHalf == level) {
+      return false;
+    }
+    data = (data << 1) | level;
+  }
+  halves++;
+  return true;
+}
+
+/*!
+ *   @fn         finish
+ *
+ *   @brief      Monta o quadro. O segundo bit de incio, invertido,  o
+ *               stimo bit do comando (RC5 estendido).
+ */
+ir_Status mkl_IRRc5Decoder::finish() {
+  uint16_t bits = data;
+
+  reset();
+  if (!(bits & 0x2000)) {
+    return ir_error;
+  }
+  result.protocol = ir_protocolRC5;
+  result.address = (bits >> 6) & 0x1F;
+  result.command = (bits & 0x3F) | ((~bits >> 6) & 0x40);
+  result.toggle = (bits >> 11) & 1;
+  result.repeat = 0;
+  return ir_frameReady;
+}
+
+#endif  //  IR_ENABLE_RC5
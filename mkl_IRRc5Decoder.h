@@ -0,0 +1,80 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do decodificador do protocolo IR RC5.
+ *
+ * @file        mkl_IRRc5Decoder.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRRC5DECODER_H_
+#define MKL_IRRC5DECODER_H_
+
+#include <stdint.h>
+#include "mkl_IRProtocol.h"
+
+/*!
+ *  @class    mkl_IRRc5Decoder
+ *
+ *  @brief    Mquina de estados do protocolo Philips RC5 (Manchester).
+ *
+ *  @details  Quadro de 14 bits com meio-bit de 889 us: dois bits de incio,
+ *            bit de alternncia, 5 bits de endereo e 6 bits de comando.
+ *            O bit '1'  espao seguido de marca. Cada intervalo recebido
+ *            vale um ou dois meios-bits; o primeiro meio-bit (espao) do
+ *            quadro  implcito, assim como o ltimo espao de um bit '0'.
+ *            Um quadro s  iniciado aps repouso da linha, evitando que
+ *            trechos de quadros de outros protocolos sejam aceitos.
+ */
+class mkl_IRRc5Decoder {
+ public:
+  mkl_IRRc5Decoder();
+  void reset();
+  ir_Status feed(uint8_t mark, uint16_t ticks);
+  ir_Status idle();
+  const ir_Frame &frame() const;
+
+ private:
+  bool appendHalf(uint8_t level);
+  ir_Status finish();
+
+  uint16_t data;
+  uint8_t halves;
+  uint8_t firstHalf;
+  bool armed;
+  ir_Frame result;
+};
+
+#endif  //  MKL_IRRC5DECODER_H_
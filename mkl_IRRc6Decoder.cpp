@@ -0,0 +1,230 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do decodificador do protocolo IR RC6.
+ *
+ * @file        mkl_IRRc6Decoder.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRConfig.h"
+
+#if IR_ENABLE_RC6
+
+#include "mkl_IRRc6Decoder.h"
+
+/*!
+ * Tempos nominais do protocolo e tamanho do quadro em unidades T
+ * (4 bits de 2T, trailer de 4T e 16 bits de 2T).
+ */
+static const uint16_t rc6Unit = IR_TICKS(444);
+static const uint16_t rc6LeaderMark = IR_TICKS(2666);
+static const uint16_t rc6LeaderSpace = IR_TICKS(889);
+static const uint8_t rc6TrailerStart = 8;
+static const uint8_t rc6TrailerEnd = 12;
+static const uint8_t rc6Units = 44;
+
+/*!
+ *   @fn         mkl_IRRc6Decoder
+ *
+ *   @brief      Construtor da classe, inicia a mquina em repouso.
+ */
+mkl_IRRc6Decoder::mkl_IRRc6Decoder() {
+  reset();
+}
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Descarta o quadro parcial e volta ao estado de repouso.
+ */
+void mkl_IRRc6Decoder::reset() {
+  state = rc6_idle;
+  data = 0;
+  units = 0;
+  firstHalf = 0;
+  lastLevel = 0;
+}
+
+/*!
+ *   @fn         feed
+ *
+ *   @brief      Processa um intervalo entre duas bordas do receptor.
+ *
+ *   @param[in]  mark - 1 se o intervalo encerrado foi de portadora presente.
+ *               ticks - durao do intervalo em ciclos da base de tempo.
+ */
+ir_Status mkl_IRRc6Decoder::feed(uint8_t mark, uint16_t ticks) {
+  uint8_t n;
+
+  switch (state) {
+    case rc6_idle:
+      if (mark && ir_match(ticks, rc6LeaderMark)) {
+        state = rc6_leaderSpace;
+      }
+      return ir_busy;
+
+    case rc6_leaderSpace:
+      if (!mark && ir_match(ticks, rc6LeaderSpace)) {
+        state = rc6_data;
+        return ir_busy;
+      }
+      return fail(mark, ticks);
+
+    case rc6_data:
+      n = ir_units(ticks, rc6Unit, 3);
+      if (n == 0) {
+        return fail(mark, ticks);
+      }
+      while (n--) {
+        if (!appendUnit(mark)) {
+          return fail(mark, ticks);
+        }
+      }
+      /*!
+       * Quadro terminado em bit '1': o ltimo meio-bit (espao) no gera
+       * borda.
+       */
+      if (units == rc6Units - 1 && mark) {
+        appendUnit(0);
+      }
+      if (units == rc6Units) {
+        return finish();
+      }
+      return ir_busy;
+  }
+  return fail(mark, ticks);
+}
+
+/*!
+ *   @fn         idle
+ *
+ *   @brief      Informa que a linha ficou em repouso, descartando
+ *               quadros incompletos.
+ */
+ir_Status mkl_IRRc6Decoder::idle() {
+  if (state == rc6_idle) {
+    return ir_busy;
+  }
+  reset();
+  return ir_error;
+}
+
+/*!
+ *   @fn         frame
+ *
+ *   @brief      Retorna o ltimo quadro decodificado.
+ */
+const ir_Frame &mkl_IRRc6Decoder::frame() const {
+  return result;
+}
+
+/*!
+ *   @fn         appendUnit
+ *
+ *   @brief      Acrescenta uma unidade T ao quadro.
+ *
+ *   @details    A posio da unidade define o meio-bit a que pertence; no
+ *               trailer cada meio-bit ocupa duas unidades, que devem ter o
+ *               mesmo nvel. O bit  armazenado no incio do segundo
+ *               meio-bit, aps verificar a transio Manchester.
+ *
+ *   @return     false em violao da codificao.
+ */
+bool mkl_IRRc6Decoder::appendUnit(uint8_t level) {
+  uint8_t half;
+  uint8_t first = 1;
+
+  if (units < rc6TrailerStart) {
+    half = units & 1;
+  } else if (units < rc6TrailerEnd) {
+    half = (units - rc6TrailerStart) >> 1;
+    first = !((units - rc6TrailerStart) & 1);
+  } else {
+    half = (units - rc6TrailerEnd) & 1;
+  }
+
+  if (!first) {
+    if (level != lastLevel) {
+      return false;
+    }
+  } else if (half == 0) {
+    firstHalf = level;
+  } else {
+    if (level == firstHalf) {
+      return false;
+    }
+    data = (data << 1) | firstHalf;
+  }
+  lastLevel = level;
+  units++;
+  return true;
+}
+
+/*!
+ *   @fn         fail
+ *
+ *   @brief      Descarta o quadro parcial. Se o intervalo rejeitado for
+ *               uma marca de lder, a decodificao recomea por ela.
+ */
+ir_Status mkl_IRRc6Decoder::fail(uint8_t mark, uint16_t ticks) {
+  reset();
+  if (mark && ir_match(ticks, rc6LeaderMark)) {
+    state = rc6_leaderSpace;
+  }
+  return ir_error;
+}
+
+/*!
+ *   @fn         finish
+ *
+ *   @brief      Monta o quadro. Aceita apenas bit de incio '1' e modo 0.
+ */
+ir_Status mkl_IRRc6Decoder::finish() {
+  uint32_t bits = data;
+
+  reset();
+  if (((bits >> 17) & 0xF) != 0x8) {
+    return ir_error;
+  }
+  result.protocol = ir_protocolRC6;
+  result.address = (bits >> 8) & 0xFF;
+  result.command = bits & 0xFF;
+  result.toggle = (bits >> 16) & 1;
+  result.repeat = 0;
+  return ir_frameReady;
+}
+
+#endif  //  IR_ENABLE_RC6
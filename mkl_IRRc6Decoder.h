@@ -0,0 +1,86 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do decodificador do protocolo IR RC6.
+ *
+ * @file        mkl_IRRc6Decoder.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRRC6DECODER_H_
+#define MKL_IRRC6DECODER_H_
+
+#include <stdint.h>
+#include "mkl_IRProtocol.h"
+
+/*!
+ *  @class    mkl_IRRc6Decoder
+ *
+ *  @brief    Mquina de estados do protocolo Philips RC6, modo 0.
+ *
+ *  @details  Unidade T de 444 us. Lder de 6T de marca e 2T de espao,
+ *            seguido de bit de incio, 3 bits de modo, bit de alternncia
+ *            (trailer, com meios-bits de 2T), 8 bits de endereo e 8 de
+ *            comando. O bit '1'  marca seguida de espao. Os intervalos
+ *            so quantizados em unidades T e percorridos um a um.
+ */
+class mkl_IRRc6Decoder {
+ public:
+  mkl_IRRc6Decoder();
+  void reset();
+  ir_Status feed(uint8_t mark, uint16_t ticks);
+  ir_Status idle();
+  const ir_Frame &frame() const;
+
+ private:
+  typedef enum {
+    rc6_idle = 0,
+    rc6_leaderSpace,
+    rc6_data
+  } rc6_State;
+
+  bool appendUnit(uint8_t level);
+  ir_Status fail(uint8_t mark, uint16_t ticks);
+  ir_Status finish();
+
+  rc6_State state;
+  uint32_t data;
+  uint8_t units;
+  uint8_t firstHalf;
+  uint8_t lastLevel;
+  ir_Frame result;
+};
+
+#endif  //  MKL_IRRC6DECODER_H_
@@ -0,0 +1,202 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do grupo de receptores IR com base de tempo comum.
+ *
+ * @file        mkl_IRReceiverGroup.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRReceiverGroup.h"
+
+/*!
+ *   @fn         mkl_IRReceiverGroup
+ *
+ *   @brief      Construtor da classe, inicia o grupo vazio.
+ */
+mkl_IRReceiverGroup::mkl_IRReceiverGroup() {
+  numReceivers = 0;
+  acceptedTimestamp = 0;
+  hasAccepted = false;
+  flagFrame = false;
+  source = 0;
+  duplicates = 0;
+}
+
+/*!
+ *   @fn         addReceiver
+ *
+ *   @brief      Acrescenta um receptor ao grupo.
+ *
+ *   @param[in]  receiver - receptor, construdo com um canal do TPM comum.
+ *               channel - canal do DMA dedicado a esse receptor.
+ *
+ *   @return     false se o grupo j est completo.
+ */
+bool mkl_IRReceiverGroup::addReceiver(mkl_RemoteControl *receiver,
+                                      dma_Channel channel) {
+  if (numReceivers >= IR_MAX_RECEIVERS) {
+    return false;
+  }
+  receivers[numReceivers] = receiver;
+  channels[numReceivers] = channel;
+  frames[numReceivers] = 0;
+  numReceivers++;
+  return true;
+}
+
+/*!
+ *   @fn         enable
+ *
+ *   @brief      Inicia a captura em todos os receptores.
+ *
+ *   @details    O primeiro receptor reinicia e liga o contador do TPM; os
+ *               demais apenas se juntam a ele, mantendo a base de tempo.
+ */
+void mkl_IRReceiverGroup::enable(ir_Protocol protocol) {
+  uint8_t i;
+
+  for (i = 0; i < numReceivers; i++) {
+    if (i == 0) {
+      receivers[i]->enableDMACapture(protocol, channels[i]);
+    } else {
+      receivers[i]->joinDMACapture(protocol, channels[i]);
+    }
+  }
+  hasAccepted = false;
+  flagFrame = false;
+}
+
+/*!
+ *   @fn         frameAvailable
+ *
+ *   @brief      Decodifica as bordas de todos os receptores e informa se
+ *               h um quadro novo (no duplicado) no lido.
+ */
+bool mkl_IRReceiverGroup::frameAvailable() {
+  uint8_t i;
+
+  for (i = 0; i < numReceivers; i++) {
+    if (!receivers[i]->frameAvailable()) {
+      continue;
+    }
+    ir_Frame frame = receivers[i]->readFrame();
+    uint16_t timestamp = receivers[i]->frameTimestamp();
+
+    frames[i]++;
+    if (isDuplicate(frame, timestamp)) {
+      duplicates++;
+      continue;
+    }
+    accepted = frame;
+    acceptedTimestamp = timestamp;
+    hasAccepted = true;
+    source = i;
+    flagFrame = true;
+  }
+  return flagFrame;
+}
+
+/*!
+ *   @fn         readFrame
+ *
+ *   @brief      Retorna o ltimo quadro aceito e o marca como lido.
+ */
+ir_Frame mkl_IRReceiverGroup::readFrame() {
+  flagFrame = false;
+  return accepted;
+}
+
+/*!
+ *   @fn         lastReceiver
+ *
+ *   @brief      ndice do receptor que entregou o ltimo quadro aceito.
+ */
+uint8_t mkl_IRReceiverGroup::lastReceiver() {
+  return source;
+}
+
+/*!
+ *   @fn         frameCount
+ *
+ *   @brief      Quadros decodificados pelo receptor, incluindo duplicatas.
+ */
+uint16_t mkl_IRReceiverGroup::frameCount(uint8_t receiver) {
+  if (receiver >= numReceivers) {
+    return 0;
+  }
+  return frames[receiver];
+}
+
+/*!
+ *   @fn         duplicateCount
+ *
+ *   @brief      Cpias descartadas por j terem sido entregues.
+ */
+uint16_t mkl_IRReceiverGroup::duplicateCount() {
+  return duplicates;
+}
+
+/*!
+ *   @fn         isDuplicate
+ *
+ *   @brief      Verifica se o quadro  cpia do ltimo aceito: mesmo
+ *               contedo e terminado a menos de IR_DEDUP_TICKS dele.
+ *
+ *   @details    A diferena  tomada nos dois sentidos, pois a cpia pode
+ *               ter terminado antes (receptor consultado depois). O
+ *               contador de 16 bits d a volta em cerca de 400 ms, bem
+ *               acima da janela.
+ */
+bool mkl_IRReceiverGroup::isDuplicate(const ir_Frame &frame,
+                                      uint16_t timestamp) {
+  uint16_t delta;
+
+  if (!hasAccepted) {
+    return false;
+  }
+  if (frame.protocol != accepted.protocol
+      || frame.address != accepted.address
+      || frame.command != accepted.command
+      || frame.toggle != accepted.toggle
+      || frame.repeat != accepted.repeat) {
+    return false;
+  }
+  delta = timestamp - acceptedTimestamp;
+  if (delta > 0x8000) {
+    delta = -delta;
+  }
+  return delta < IR_DEDUP_TICKS;
+}
@@ -0,0 +1,122 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do grupo de receptores IR com base de tempo comum.
+ *
+ * @file        mkl_IRReceiverGroup.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRRECEIVERGROUP_H_
+#define MKL_IRRECEIVERGROUP_H_
+
+#include <stdint.h>
+#include "mkl_IRConfig.h"
+#include "mkl_IRProtocol.h"
+#include "mkl_RemoteControl.h"
+
+/*!
+ *  @class    mkl_IRReceiverGroup.
+ *
+ *  @brief    Vrios receptores IR tratados como uma s entrada.
+ *
+ *  @details  Os receptores (por exemplo, frente e lateral de um cassete
+ *            de teto) usam canais do mesmo TPM, cujo contador livre  a
+ *            base de tempo comum, e cada um tem o seu canal de DMA. Um
+ *            toque de tecla chega a mais de um receptor; o quadro 
+ *            entregue na primeira chegada e as cpias com o mesmo
+ *            contedo terminadas dentro de IR_DEDUP_TICKS so descartadas.
+ *
+ *            A deduplicao no acrescenta espera: o primeiro quadro 
+ *            entregue assim que decodificado, e as cpias so comparadas
+ *            com ele pelo instante da ltima borda.
+ *
+ *            Todos os receptores devem ser construdos antes de enable(),
+ *            pois o construtor de mkl_RemoteControl para o contador.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Dois receptores no TPM2.
+ *              +fn mkl_RemoteControl frente(gpio_GPIOE, tpm_PTE22);
+ *              +fn mkl_RemoteControl lado(gpio_GPIOE, tpm_PTE23);
+ *              +fn grupo.addReceiver(&frente, dma_Ch2);
+ *              +fn grupo.addReceiver(&lado, dma_Ch3);
+ *              +fn grupo.enable(ir_protocolAuto);
+ *              +fn grupo.frameAvailable();
+ *              +fn grupo.readFrame();
+ */
+class mkl_IRReceiverGroup {
+ public:
+  /*!
+   * Mtodo construtor padro da classe.
+   */
+  mkl_IRReceiverGroup();
+
+  /*!
+   * Mtodos de configurao do grupo.
+   */
+  bool addReceiver(mkl_RemoteControl *receiver, dma_Channel channel);
+  void enable(ir_Protocol protocol);
+
+  /*!
+   * Mtodos de leitura dos quadros, j sem duplicatas.
+   */
+  bool frameAvailable();
+  ir_Frame readFrame();
+  uint8_t lastReceiver();
+
+  /*!
+   * Contadores de quadros por receptor e de cpias descartadas.
+   */
+  uint16_t frameCount(uint8_t receiver);
+  uint16_t duplicateCount();
+
+ private:
+  bool isDuplicate(const ir_Frame &frame, uint16_t timestamp);
+
+  mkl_RemoteControl *receivers[IR_MAX_RECEIVERS];
+  dma_Channel channels[IR_MAX_RECEIVERS];
+  uint16_t frames[IR_MAX_RECEIVERS];
+  uint8_t numReceivers;
+
+  ir_Frame accepted;
+  uint16_t acceptedTimestamp;
+  bool hasAccepted;
+  bool flagFrame;
+  uint8_t source;
+  uint16_t duplicates;
+};
+
+#endif  //  MKL_IRRECEIVERGROUP_H_
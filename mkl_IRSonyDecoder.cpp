@@ -0,0 +1,184 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do decodificador do protocolo IR Sony SIRC.
+ *
+ * @file        mkl_IRSonyDecoder.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRConfig.h"
+
+#if IR_ENABLE_SONY
+
+#include "mkl_IRSonyDecoder.h"
+
+/*!
+ * Tempos nominais do protocolo, em ciclos da base de tempo.
+ */
+static const uint16_t sonyLeaderMark = IR_TICKS(2400);
+static const uint16_t sonyUnit = IR_TICKS(600);
+static const uint16_t sonyOneMark = IR_TICKS(1200);
+static const uint16_t sonyGap = IR_TICKS(2400);
+
+/*!
+ *   @fn         mkl_IRSonyDecoder
+ *
+ *   @brief      Construtor da classe, inicia a mquina em repouso.
+ */
+mkl_IRSonyDecoder::mkl_IRSonyDecoder() {
+  reset();
+}
+
+/*!
+ *   @fn         reset
+ *
+ *   @brief      Descarta o quadro parcial e volta ao estado de repouso.
+ */
+void mkl_IRSonyDecoder::reset() {
+  state = sony_idle;
+  data = 0;
+  bits = 0;
+}
+
+/*!
+ *   @fn         feed
+ *
+ *   @brief      Processa um intervalo entre duas bordas do receptor.
+ *
+ *   @param[in]  mark - 1 se o intervalo encerrado foi de portadora presente.
+ *               ticks - durao do intervalo em ciclos da base de tempo.
+ */
+ir_Status mkl_IRSonyDecoder::feed(uint8_t mark, uint16_t ticks) {
+  switch (state) {
+    case sony_idle:
+      if (mark && ir_match(ticks, sonyLeaderMark)) {
+        data = 0;
+        bits = 0;
+        state = sony_space;
+      }
+      return ir_busy;
+
+    case sony_space:
+      if (mark) {
+        return fail(mark, ticks);
+      }
+      if (ir_match(ticks, sonyUnit)) {
+        state = sony_mark;
+        return ir_busy;
+      }
+      if (ticks >= sonyGap) {
+        return finish();
+      }
+      return fail(mark, ticks);
+
+    case sony_mark:
+      if (!mark || bits == 20) {
+        return fail(mark, ticks);
+      }
+      if (ir_match(ticks, sonyOneMark)) {
+        data |= (uint32_t)1 << bits;
+      } else if (!ir_match(ticks, sonyUnit)) {
+        return fail(mark, ticks);
+      }
+      bits++;
+      state = sony_space;
+      return ir_busy;
+  }
+  return fail(mark, ticks);
+}
+
+/*!
+ *   @fn         idle
+ *
+ *   @brief      Informa que a linha ficou em repouso, encerrando o quadro
+ *               em andamento.
+ */
+ir_Status mkl_IRSonyDecoder::idle() {
+  if (state == sony_idle) {
+    return ir_busy;
+  }
+  if (state == sony_space) {
+    return finish();
+  }
+  reset();
+  return ir_error;
+}
+
+/*!
+ *   @fn         frame
+ *
+ *   @brief      Retorna o ltimo quadro decodificado.
+ */
+const ir_Frame &mkl_IRSonyDecoder::frame() const {
+  return result;
+}
+
+/*!
+ *   @fn         fail
+ *
+ *   @brief      Descarta o quadro parcial. Se o intervalo rejeitado for
+ *               uma marca de incio, a decodificao recomea por ela.
+ */
+ir_Status mkl_IRSonyDecoder::fail(uint8_t mark, uint16_t ticks) {
+  reset();
+  if (mark && ir_match(ticks, sonyLeaderMark)) {
+    state = sony_space;
+  }
+  return ir_error;
+}
+
+/*!
+ *   @fn         finish
+ *
+ *   @brief      Monta o quadro se o nmero de bits for vlido.
+ */
+ir_Status mkl_IRSonyDecoder::finish() {
+  uint32_t bits20 = data;
+  uint8_t count = bits;
+
+  reset();
+  if (count != 12 && count != 15 && count != 20) {
+    return ir_error;
+  }
+  result.protocol = ir_protocolSony;
+  result.command = bits20 & 0x7F;
+  result.address = bits20 >> 7;
+  result.toggle = 0;
+  result.repeat = 0;
+  return ir_frameReady;
+}
+
+#endif  //  IR_ENABLE_SONY
@@ -0,0 +1,83 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do decodificador do protocolo IR Sony SIRC.
+ *
+ * @file        mkl_IRSonyDecoder.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRSONYDECODER_H_
+#define MKL_IRSONYDECODER_H_
+
+#include <stdint.h>
+#include "mkl_IRProtocol.h"
+
+/*!
+ *  @class    mkl_IRSonyDecoder
+ *
+ *  @brief    Mquina de estados do protocolo Sony SIRC (largura de pulso).
+ *
+ *  @details  Marca de incio de 2,4 ms; cada bit  um espao de 600 us
+ *            seguido de marca de 600 us (bit 0) ou 1200 us (bit 1), LSB
+ *            primeiro: 7 bits de comando e 5, 8 ou 13 bits de endereo
+ *            (quadros de 12, 15 ou 20 bits). Como o quadro no possui
+ *            marca final, ele  encerrado pelo espao de repouso seguinte.
+ */
+class mkl_IRSonyDecoder {
+ public:
+  mkl_IRSonyDecoder();
+  void reset();
+  ir_Status feed(uint8_t mark, uint16_t ticks);
+  ir_Status idle();
+  const ir_Frame &frame() const;
+
+ private:
+  typedef enum {
+    sony_idle = 0,
+    sony_space,
+    sony_mark
+  } sony_State;
+
+  ir_Status fail(uint8_t mark, uint16_t ticks);
+  ir_Status finish();
+
+  sony_State state;
+  uint32_t data;
+  uint8_t bits;
+  ir_Frame result;
+};
+
+#endif  //  MKL_IRSONYDECODER_H_
@@ -0,0 +1,231 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao do transmissor IR com portadora por PWM.
+ *
+ * @file        mkl_IRTransmitter.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_IRTransmitter.h"
+
+/*!
+ *   @fn         mkl_IRTransmitter
+ *
+ *   @brief      Associa o pino da portadora e o canal do PIT que conta os
+ *               intervalos. A portadora inicia desligada.
+ *
+ *   @param[in]  pin - pino do TPM ligado ao LED emissor.
+ *               gate - canal do PIT usado na temporizao da rajada.
+ */
+mkl_IRTransmitter::mkl_IRTransmitter(tpm_Pin pin, PIT_ChPIT gate)
+                                    : gateTimer(gate) {
+  uint8_t pinNumber;
+  uint8_t GPIONumber;
+  uint8_t chnNumber;
+  uint8_t TPMNumber;
+  uint8_t muxAltMask;
+  uint8_t *baseAddress;
+
+  setTPMParameters(pin, pinNumber, GPIONumber, chnNumber,
+                   TPMNumber, muxAltMask);
+  setBaseAddress(TPMNumber, &baseAddress);
+  bindPeripheral(baseAddress);
+  bindChannel(baseAddress, chnNumber);
+  bindPin(GPIONumber, pinNumber);
+  enablePeripheralClock(TPMNumber);
+  enableGPIOClock(GPIONumber);
+  selectMuxAlternative(muxAltMask);
+
+  gateTimer.enablePeripheralModule();
+  burst.length = 0;
+  current = 0;
+  busy = false;
+}
+
+/*!
+ *   @fn         send
+ *
+ *   @brief      Codifica e inicia a transmisso de um quadro.
+ *
+ *   @return     false se h transmisso em curso, o protocolo no 
+ *               suportado pelo codificador ou o TPM est em uso.
+ */
+bool mkl_IRTransmitter::send(const ir_Frame &frame) {
+  if (busy || !acquireExclusive()) {
+    return false;
+  }
+  if (!mkl_IREncoder::encode(frame, &burst) || burst.length == 0) {
+    releaseExclusive();
+    return false;
+  }
+  start();
+  return true;
+}
+
+/*!
+ *   @fn         sendBurst
+ *
+ *   @brief      Inicia a transmisso de uma tabela de tempos j pronta
+ *               (por exemplo, capturada de outro controle remoto).
+ *
+ *   @return     false se h transmisso em curso, a tabela  vazia ou o
+ *               TPM est em uso.
+ */
+bool mkl_IRTransmitter::sendBurst(const ir_Burst &table) {
+  if (busy || table.length == 0 || !acquireExclusive()) {
+    return false;
+  }
+  burst = table;
+  start();
+  return true;
+}
+
+/*!
+ *   @fn         isBusy
+ *
+ *   @brief      Informa se h uma rajada em transmisso.
+ */
+bool mkl_IRTransmitter::isBusy() const {
+  return busy;
+}
+
+/*!
+ *   @fn         isInterruptPending
+ *
+ *   @brief      Informa se o canal do PIT do transmissor pediu interrupo.
+ */
+bool mkl_IRTransmitter::isInterruptPending() {
+  return gateTimer.isInterruptFlagSet();
+}
+
+/*!
+ *   @fn         handleInterrupt
+ *
+ *   @brief      Fim de um intervalo: chaveia a portadora para o seguinte.
+ *
+ *   @details    O PIT j recarregou a durao do novo intervalo (escrita
+ *               no LDVAL durante o intervalo anterior); aqui  escrita a
+ *               durao do prximo. Ao fim da tabela a portadora 
+ *               desligada, o canal do PIT parado e o TPM devolvido ao
+ *               rbitro.
+ */
+void mkl_IRTransmitter::handleInterrupt() {
+  uint8_t next;
+
+  gateTimer.clearInterruptFlag();
+  if (!busy) {
+    return;
+  }
+  next = current + 1;
+  if (next >= burst.length) {
+    stop();
+    return;
+  }
+  current = next;
+  setCarrier((next & 1) == 0);
+  if (next + 1 < burst.length) {
+    gateTimer.setPeriod(IR_TX_COUNTS(burst.us[next + 1]));
+  }
+}
+
+/*!
+ *   @fn         setupCarrier
+ *
+ *   @brief      Configura o TPM em PWM alinhado  borda, sada em nvel
+ *               alto at CnV, na frequncia da portadora. A rajada comea
+ *               sempre por uma marca, ento a portadora j parte ligada.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ *               - TPMxMOD: Modulo Register. Pg.554.
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+void mkl_IRTransmitter::setupCarrier() {
+  *addressTPMxSC = 0;
+  *addressTPMxCNT = 0;
+  *addressTPMxMOD = IR_TX_CARRIER_MOD;
+  *addressTPMxCnSC = 0x20 | 0x08;
+  *addressTPMxCnV = IR_TX_CARRIER_CNV;
+  *addressTPMxSC = tpm_div1 | 0x08;
+}
+
+/*!
+ *   @fn         setCarrier
+ *
+ *   @brief      Liga (ciclo de 1/3) ou desliga (CnV = 0) a portadora.
+ *               A escrita s tem efeito no prximo ciclo da portadora.
+ */
+void mkl_IRTransmitter::setCarrier(uint8_t on) {
+  *addressTPMxCnV = on ? IR_TX_CARRIER_CNV : 0;
+}
+
+/*!
+ *   @fn         start
+ *
+ *   @brief      Liga a portadora para a primeira marca e inicia o PIT com
+ *               a sua durao, deixando a do segundo intervalo no LDVAL.
+ */
+void mkl_IRTransmitter::start() {
+  current = 0;
+  busy = true;
+  setupCarrier();
+
+  gateTimer.disableTimer();
+  gateTimer.clearInterruptFlag();
+  gateTimer.setPeriod(IR_TX_COUNTS(burst.us[0]));
+  gateTimer.enableTimer();
+  if (burst.length > 1) {
+    gateTimer.setPeriod(IR_TX_COUNTS(burst.us[1]));
+  }
+  gateTimer.enableInterruptRequests();
+}
+
+/*!
+ *   @fn         stop
+ *
+ *   @brief      Desliga a portadora, para o canal do PIT e devolve o TPM
+ *               ao rbitro, que pode voltar a compartilh-lo.
+ *
+ *   @details    Chamado na interrupo do fim da rajada. O canal fica em
+ *               PWM com CnV = 0 (LED apagado) at o prximo usurio
+ *               reconfigurar o mdulo.
+ */
+void mkl_IRTransmitter::stop() {
+  setCarrier(0);
+  gateTimer.disableTimer();
+  releaseExclusive();
+  busy = false;
+}
@@ -0,0 +1,119 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface do transmissor IR com portadora por PWM.
+ *
+ * @file        mkl_IRTransmitter.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_IRTRANSMITTER_H_
+#define MKL_IRTRANSMITTER_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPM.h"
+#include "mkl_PITPeriodicInterrupt.h"
+#include "mkl_IREncoder.h"
+
+/*!
+ *  @class    mkl_IRTransmitter.
+ *
+ *  @brief    Transmissor IR: portadora PWM chaveada por tabela de tempos.
+ *
+ *  @details  A portadora de 38 kHz  gerada por um canal PWM do TPM. Um
+ *            canal do PIT conta a durao de cada marca/espao da rajada;
+ *            a cada estouro a rotina de interrupo apenas liga ou desliga
+ *            a portadora (CnV) e programa o intervalo seguinte, de modo
+ *            que o quadro inteiro  enviado sem espera ocupada.
+ *
+ *            O LDVAL do PIT  duplamente bufferizado: o valor escrito s 
+ *            carregado no prximo estouro, e a escrita de CnV em modo PWM
+ *            s vale no prximo ciclo da portadora. Por isso os intervalos
+ *            no acumulam a latncia da interrupo e a portadora  sempre
+ *            chaveada em ciclos completos.
+ *
+ *            O TPM escolhido fica dedicado  portadora: send() o
+ *            reconfigura a cada quadro e por isso pede o mdulo exclusivo
+ *            ao mkl_TPMManager, recusando o envio se o TPM j est em uso
+ *            (na placa, o TPM1 do pino padro  dividido entre o
+ *            tacmetro e o servo da aleta). Como os dois
+ *            canais do PIT compartilham a mesma interrupo, PIT_IRQHandler
+ *            deve chamar handleInterrupt() quando isInterruptPending().
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Envio de um comando NEC.
+ *              +fn mkl_IRTransmitter ir(tpm_PTE21, PIT_Ch1);
+ *              +fn ir.send(frame);
+ *              +fn ir.isBusy();
+ */
+class mkl_IRTransmitter : public mkl_TPM {
+ public:
+  /*!
+   * Mtodo construtor padro da classe.
+   */
+  explicit mkl_IRTransmitter(tpm_Pin pin = tpm_PTE21,
+                             PIT_ChPIT gate = PIT_Ch1);
+
+  /*!
+   * Mtodos de transmisso.
+   */
+  bool send(const ir_Frame &frame);
+  bool sendBurst(const ir_Burst &burst);
+  bool isBusy() const;
+
+  /*!
+   * Mtodos de tratamento da interrupo do PIT.
+   */
+  bool isInterruptPending();
+  void handleInterrupt();
+
+ private:
+  /*!
+   * Mtodos de controle da portadora.
+   */
+  void setupCarrier();
+  void setCarrier(uint8_t on);
+  void start();
+  void stop();
+
+  mkl_PITInterruptInterrupt gateTimer;
+  ir_Burst burst;
+  volatile uint8_t current;
+  volatile bool busy;
+};
+
+#endif  //  MKL_IRTRANSMITTER_H_
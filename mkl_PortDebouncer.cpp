@@ -0,0 +1,146 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao da classe "mkl_PortDebouncer".
+ *
+ * @file        mkl_PortDebouncer.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_PortDebouncer.h"
+
+/*!
+ *   @fn         mkl_PortDebouncer
+ *
+ *   @brief      Associa o objeto ao PDIR da porta e inicia o estado com a
+ *               leitura atual dos pinos.
+ *
+ *   @param[in]  port - porta GPIO.
+ *               mask - pinos tratados (bit n = pino n).
+ *               activeLow - true para botes com pull-up (pressionado = 0).
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - PDIR: Port Data Input Register. Pg. 777.
+ */
+mkl_PortDebouncer::mkl_PortDebouncer(gpio_Name port, uint32_t mask,
+                                     bool activeLow) {
+  addressPDIR = (volatile uint32_t *)(GPIOA_BASE + 0x10
+                                      + 0x40*(port >> 8));
+  this->mask = mask;
+  invert = activeLow ? 0xFFFFFFFF : 0;
+  count0 = 0xFFFFFFFF;
+  count1 = 0xFFFFFFFF;
+  debounced = (*addressPDIR ^ invert) & mask;
+  pressed = 0;
+  released = 0;
+}
+
+/*!
+ *   @fn         addPins
+ *
+ *   @brief      Inclui pinos na mscara, com o estado inicial lido agora.
+ */
+void mkl_PortDebouncer::addPins(uint32_t pins) {
+  uint32_t level;
+
+  mask |= pins;
+  level = (*addressPDIR ^ invert) & pins;
+  debounced = (debounced & ~pins) | level;
+}
+
+/*!
+ *   @fn         sample
+ *
+ *   @brief      L a porta e avana os contadores verticais.
+ *
+ *   @details    changed marca os pinos cuja amostra difere do estado. Para
+ *               esses pinos o contador (count1:count0) segue 11, 10, 01,
+ *               00 e, na quarta amostra, o pino muda de estado; para os
+ *               demais ele volta a 11. So cerca de 12 operaes lgicas
+ *               por chamada, independente do nmero de pinos.
+ */
+void mkl_PortDebouncer::sample() {
+  uint32_t changed = ((*addressPDIR ^ invert) & mask) ^ debounced;
+
+  count0 = ~(count0 & changed);
+  count1 = count0 ^ (count1 & changed);
+  changed &= count0 & count1;
+  debounced ^= changed;
+  pressed |= debounced & changed;
+  released |= ~debounced & changed;
+}
+
+/*!
+ *   @fn         isSettled
+ *
+ *   @brief      Indica que nenhum pino da mscara est em contagem, isto ,
+ *               todas as amostras recentes coincidem com o estado.
+ */
+bool mkl_PortDebouncer::isSettled() {
+  return (count0 & count1 & mask) == mask;
+}
+
+/*!
+ *   @fn         state
+ *
+ *   @brief      Estado estvel dos pinos (bit em 1 = pressionado).
+ */
+uint32_t mkl_PortDebouncer::state() {
+  return debounced;
+}
+
+/*!
+ *   @fn         readPressed
+ *
+ *   @brief      Pinos pressionados desde a ltima leitura (limpa a mscara).
+ */
+uint32_t mkl_PortDebouncer::readPressed() {
+  uint32_t bits = pressed;
+
+  pressed &= ~bits;
+  return bits;
+}
+
+/*!
+ *   @fn         readReleased
+ *
+ *   @brief      Pinos soltos desde a ltima leitura (limpa a mscara).
+ */
+uint32_t mkl_PortDebouncer::readReleased() {
+  uint32_t bits = released;
+
+  released &= ~bits;
+  return bits;
+}
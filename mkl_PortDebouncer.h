@@ -0,0 +1,113 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe "mkl_PortDebouncer".
+ *
+ * @file        mkl_PortDebouncer.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_PORTDEBOUNCER_H_
+#define MKL_PORTDEBOUNCER_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_GPIO.h"
+
+/*!
+ *  @class    mkl_PortDebouncer.
+ *
+ *  @brief    Debounce paralelo de todos os pinos de uma porta GPIO.
+ *
+ *  @details  A cada chamada de sample() (no tick peridico do PIT) a
+ *            palavra PDIR inteira da porta  lida uma vez e cada bit passa
+ *            por um contador vertical de 2 bits: os bits de ordem 0 e 1
+ *            dos 32 contadores ficam em duas palavras (count0 e count1) e
+ *            so atualizados com operaes lgicas sobre a palavra toda.
+ *            Um pino s muda de estado aps 4 amostras seguidas diferentes
+ *            do estado atual; qualquer amostra igual zera o seu contador.
+ *
+ *            O custo  o mesmo para 1 ou 32 botes na porta. O resultado
+ *            so as mscaras dos pinos recm pressionados e soltos,
+ *            acumuladas at serem lidas. As mscaras devem ser lidas no
+ *            mesmo contexto de sample() (ou com a sua interrupo
+ *            mascarada), pois a leitura as limpa.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Botes ativos em nvel baixo nos pinos 1, 2 e 12 da porta A.
+ *              +fn mkl_PortDebouncer portaA(gpio_GPIOA, (1<<1)|(1<<2)|(1<<12));
+ *              +fn portaA.sample();      // na rotina PIT_IRQHandler
+ *              +fn portaA.readPressed();
+ *              +fn portaA.readReleased();
+ */
+class mkl_PortDebouncer {
+ public:
+  /*!
+   * Mtodo construtor padro da classe.
+   */
+  explicit mkl_PortDebouncer(gpio_Name port = gpio_GPIOA,
+                             uint32_t mask = 0, bool activeLow = true);
+
+  /*!
+   * Mtodo de incluso de pinos na mscara.
+   */
+  void addPins(uint32_t pins);
+
+  /*!
+   * Mtodo de amostragem, chamado a cada tick.
+   */
+  void sample();
+  bool isSettled();
+
+  /*!
+   * Mtodos de leitura do estado e das transies.
+   */
+  uint32_t state();
+  uint32_t readPressed();
+  uint32_t readReleased();
+
+ private:
+  volatile uint32_t *addressPDIR;
+  uint32_t mask;
+  uint32_t invert;
+  uint32_t count0;
+  uint32_t count1;
+  uint32_t debounced;
+  volatile uint32_t pressed;
+  volatile uint32_t released;
+};
+
+#endif  //  MKL_PORTDEBOUNCER_H_
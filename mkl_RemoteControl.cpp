@@ -42,6 +42,8 @@
 #include "mkl_GPIOInterrupt.h"
 #include "mkl_RemoteControl.h"
 #include "mkl_TPMMeasure.h"
+#include "mkl_IRDecoder.h"
+#include "mkl_DMA.h"
 
 
 /*!
@@ -68,19 +70,27 @@ mkl_RemoteControl::mkl_RemoteControl(gpio_Name gpioName, tpm_Pin pin) {
  * @details		Utiliza os m�todos das classe measure e GPIO para inicializar
  * 				estes perif�ricos
  *
- * @param[in]    gpioName - GPIO;
+ * @param[in]    gpioName - GPIO (porta do pino do receptor);
  *               pin - pino do TPM Measure
  */
 void mkl_RemoteControl::setupPeripheral(gpio_Name gpioName, tpm_Pin pin) {
+  uint32_t primask = __get_PRIMASK();
+
   __disable_irq();
 
-  gpio = mkl_GPIOInterrupt(gpio_GPIOA, gpio_PTA1);
+  /*!
+   * O GPIO é o do próprio pino do receptor: a porta vem de gpioName e o
+   * número do pino, do pino do TPM. O TPM é configurado por último, para
+   * que o mux do pino fique na alternativa do TPM.
+   */
+  gpio = mkl_GPIOInterrupt((gpio_Pin)(gpioName | (pin & 0x1F)));
   gpio.setPortMode(gpio_input);
   tpm0 = mkl_TPMMeasure(pin);
   tpm0.setFrequency(tpm_div128);
   tpm0.setEdge(tpm_falling);
 
   flagRead = true;
+  __set_PRIMASK(primask);
 }
 
 
@@ -247,3 +257,250 @@ void mkl_RemoteControl::enableInterrupt() {
 void mkl_RemoteControl::disableInterrupt() {
   gpio.disableInterrupt();
 }
+
+
+/*!
+ * @fn			enableDecoder
+ *
+ * @brief		Prepara o TPM para a decodificação multiprotocolo.
+ *
+ * @details		O contador do TPM é pedido ao mkl_TPMManager (div128,
+ * 				livre de 0 a 0xFFFF) e não é reiniciado; o canal captura
+ * 				as duas bordas do sinal com interrupção e os instantes
+ * 				são entregues a processEdge por handleInterrupt. Se o TPM
+ * 				estiver em uso com outra configuração, nada é habilitado.
+ *
+ * @param[in]	protocol - protocolo fixo ou ir_protocolAuto.
+ */
+void mkl_RemoteControl::enableDecoder(ir_Protocol protocol) {
+  decoder.setProtocol(protocol);
+  lineMark = 0;
+  flagFrame = false;
+  dmaMode = false;
+  tpm0.disableCaptureDMA();       // vindo do modo DMA
+  if (!tpm0.startSharedCapture(tpm_div128, tpm_both)) {
+    return;
+  }
+  lastEdge = tpm0.getCounter();
+  tpm0.enableCaptureInterrupt();
+}
+
+
+/*!
+ * @fn			processEdge
+ *
+ * @brief		Entrega aos decodificadores o intervalo encerrado por uma
+ * 				borda do receptor.
+ *
+ * @details		O nível do intervalo é obtido alternando a cada borda; um
+ * 				intervalo maior que IR_IDLE_TICKS só pode ser repouso
+ * 				(espaço), o que ressincroniza o nível caso uma borda seja
+ * 				perdida. Custo constante por borda, próprio para ISR.
+ *
+ * @param[in]	timestamp - valor do contador capturado na borda.
+ *
+ * @return		ir_frameReady quando um quadro é completado.
+ */
+ir_Status mkl_RemoteControl::processEdge(uint16_t timestamp) {
+  uint16_t ticks = timestamp - lastEdge;
+  uint16_t previous = lastEdge;
+  uint8_t mark = lineMark;
+  ir_Status status;
+
+  lastEdge = timestamp;
+  if (ticks >= IR_IDLE_TICKS) {
+    mark = 0;
+    status = decoder.idle();
+  } else {
+    status = decoder.feed(mark, ticks);
+  }
+  lineMark = !mark;
+
+  if (status == ir_frameReady) {
+    /*!
+     * Quadro encerrado por repouso terminou na borda anterior.
+     */
+    frameEdge = (mark == 0 && ticks >= IR_IDLE_TICKS) ? previous : timestamp;
+    flagFrame = true;
+  }
+  return status;
+}
+
+
+/*!
+ * @fn			handleInterrupt
+ *
+ * @brief		Trata a interrupção de captura do canal do receptor.
+ *
+ * @details		Deve ser chamado na rotina TPMx_IRQHandler do TPM usado.
+ */
+ir_Status mkl_RemoteControl::handleInterrupt() {
+  if (!tpm0.isCaptureFlagSet()) {
+    return ir_busy;
+  }
+  return processEdge(tpm0.readCapture());
+}
+
+
+/*!
+ * @fn			frameAvailable
+ *
+ * @brief		Retorna true se há um quadro decodificado não lido.
+ *
+ * @details		Na captura por DMA, decodifica antes as bordas pendentes.
+ */
+bool mkl_RemoteControl::frameAvailable() {
+  if (dmaMode) {
+    poll();
+  }
+  return flagFrame;
+}
+
+
+/*!
+ * @fn			readFrame
+ *
+ * @brief		Retorna o último quadro decodificado e o marca como lido.
+ */
+ir_Frame mkl_RemoteControl::readFrame() {
+  flagFrame = false;
+  return decoder.frame();
+}
+
+
+/*!
+ * @fn			enableDMACapture
+ *
+ * @brief		Prepara a captura das bordas do receptor por DMA.
+ *
+ * @details		O canal captura as duas bordas e cada captura pede ao DMA
+ * 				a cópia de CnV para um buffer circular, sem interromper a
+ * 				CPU. A decodificação é feita depois, em poll (chamado por
+ * 				frameAvailable no laço principal), sobre as bordas
+ * 				acumuladas. O contador é o compartilhado do TPM, como em
+ * 				joinDMACapture.
+ *
+ * @param[in]	protocol - protocolo fixo ou ir_protocolAuto.
+ * 				channel - canal do DMA dedicado ao receptor.
+ */
+void mkl_RemoteControl::enableDMACapture(ir_Protocol protocol,
+                                         dma_Channel channel) {
+  joinDMACapture(protocol, channel);
+}
+
+
+/*!
+ * @fn			joinDMACapture
+ *
+ * @brief		Inicia a captura por DMA sem reiniciar o contador do TPM.
+ *
+ * @details		O contador do TPM é pedido ao mkl_TPMManager: o primeiro
+ * 				receptor o configura e liga, e os que compartilham o TPM
+ * 				apenas o reutilizam. Só o canal, o DMA e o decodificador
+ * 				deste receptor são configurados.
+ *
+ * @param[in]	protocol - protocolo fixo ou ir_protocolAuto.
+ * 				channel - canal do DMA dedicado ao receptor.
+ */
+void mkl_RemoteControl::joinDMACapture(ir_Protocol protocol,
+                                       dma_Channel channel) {
+  decoder.setProtocol(protocol);
+  lineMark = 0;
+  lineIdle = true;
+  flagFrame = false;
+  readIndex = 0;
+  overruns = 0;
+
+  tpm0.disableCaptureInterrupt();
+  if (!tpm0.startSharedCapture(tpm_div128, tpm_both)) {
+    dmaMode = false;
+    return;
+  }
+
+  dma = mkl_DMA(channel);
+  dma.setRequestSource(tpm0.captureDMASource());
+  dma.setupRing16(tpm0.captureRegister(), edgeRing, IR_DMA_RING_SIZE);
+  lastRemaining = dma.remainingBytes();
+  dma.enableRequests();
+
+  lastEdge = tpm0.getCounter();
+  tpm0.enableCaptureDMA();
+  dmaMode = true;
+}
+
+
+/*!
+ * @fn			poll
+ *
+ * @brief		Decodifica as bordas capturadas desde a última chamada.
+ *
+ * @details		Se mais bordas que o tamanho do buffer chegaram entre duas
+ * 				chamadas, as pendentes são descartadas e o decodificador se
+ * 				ressincroniza no próximo repouso. O fim de quadro por
+ * 				repouso (RC5, RC6, Sony) é detectado aqui pelo tempo desde
+ * 				a última borda, sem esperar a borda do próximo quadro;
+ * 				poll deve ser chamado em intervalos menores que o período
+ * 				do contador (cerca de 400 ms).
+ *
+ * @return		ir_frameReady se algum quadro foi completado.
+ */
+ir_Status mkl_RemoteControl::poll() {
+  ir_Status result = ir_busy;
+  uint32_t remaining = dma.remainingBytes();
+  uint16_t writeIndex = dma.writeIndex();
+
+  if (((lastRemaining - remaining) >> 1) >= IR_DMA_RING) {
+    overruns++;
+    readIndex = writeIndex;
+    decoder.reset();
+    lineMark = 0;
+  }
+  lastRemaining = remaining;
+
+  while (readIndex != writeIndex) {
+    if (processEdge(edgeRing[readIndex]) == ir_frameReady) {
+      result = ir_frameReady;
+    }
+    readIndex = (readIndex + 1) & (IR_DMA_RING - 1);
+    lineIdle = false;
+  }
+
+  if (!lineIdle
+      && (uint16_t)(tpm0.getCounter() - lastEdge) >= IR_IDLE_TICKS) {
+    lineIdle = true;
+    lineMark = 0;
+    if (decoder.idle() == ir_frameReady) {
+      frameEdge = lastEdge;
+      flagFrame = true;
+      result = ir_frameReady;
+    }
+  }
+
+  if (remaining < 0x80000) {
+    dma.reloadByteCount();
+    lastRemaining = dma.remainingBytes();
+  }
+  return result;
+}
+
+
+/*!
+ * @fn			overrunCount
+ *
+ * @brief		Número de vezes em que o buffer de bordas transbordou.
+ */
+uint16_t mkl_RemoteControl::overrunCount() {
+  return overruns;
+}
+
+
+/*!
+ * @fn			frameTimestamp
+ *
+ * @brief		Instante (contador do TPM) da última borda do último quadro
+ * 				decodificado; compara quadros de receptores que
+ * 				compartilham o mesmo TPM.
+ */
+uint16_t mkl_RemoteControl::frameTimestamp() {
+  return frameEdge;
+}
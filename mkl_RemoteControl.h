@@ -44,6 +44,8 @@
 #include "mkl_GPIOInterrupt.h"
 #include "mkl_TPMMeasure.h"
 #include "mkl_TPM.h"
+#include "mkl_IRDecoder.h"
+#include "mkl_DMA.h"
 /*!
  * Enum de definio da exceo.
  */
@@ -66,6 +68,21 @@ typedef enum {
  *             +fn commandAvailable();
  *             +fn waitCommandAvailable;
  *             +fn readCommand()
+ *
+ *            Decodificao multiprotocolo a partir das bordas do receptor:
+ *             +fn enableDecoder(ir_protocolAuto);
+ *             +fn processEdge(timestamp);  // ou handleInterrupt();
+ *             +fn frameAvailable();
+ *             +fn readFrame();
+ *
+ *            Captura das bordas por DMA, decodificao sob demanda:
+ *             +fn enableDMACapture(ir_protocolAuto, dma_Ch2);
+ *             +fn frameAvailable();  // consome as bordas capturadas
+ *             +fn readFrame();
+ *
+ *            O pino do receptor  o pino do TPM passado ao construtor
+ *            (gpioName deve ser a porta desse pino). Vrios receptores no
+ *            mesmo TPM so coordenados por mkl_IRReceiverGroup.
  */
 class mkl_RemoteControl {
  public:
@@ -91,6 +108,22 @@ class mkl_RemoteControl {
     void clearInterruptFlag();
     void enableInterrupt();
     void disableInterrupt();
+    /*!
+     * Mtodos de decodificao multiprotocolo.
+     */
+    void enableDecoder(ir_Protocol protocol);
+    ir_Status processEdge(uint16_t timestamp);
+    ir_Status handleInterrupt();
+    bool frameAvailable();
+    ir_Frame readFrame();
+    /*!
+     * Mtodos de captura das bordas por DMA.
+     */
+    void enableDMACapture(ir_Protocol protocol, dma_Channel channel);
+    void joinDMACapture(ir_Protocol protocol, dma_Channel channel);
+    ir_Status poll();
+    uint16_t overrunCount();
+    uint16_t frameTimestamp();
 
  private:
     mkl_GPIOInterrupt gpio;
@@ -101,5 +134,17 @@ class mkl_RemoteControl {
     uint8_t i, j, f = 0;
     uint8_t dado[40], adress[8], command[8], Address_Ir, Command_Ir;
     uint8_t parity[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    mkl_IRDecoder decoder;
+    uint16_t lastEdge = 0;
+    uint16_t frameEdge = 0;
+    uint8_t lineMark = 0;
+    volatile bool flagFrame = false;
+    mkl_DMA dma;
+    uint16_t edgeRing[IR_DMA_RING] __attribute__((aligned(2 * IR_DMA_RING)));
+    uint16_t readIndex = 0;
+    uint32_t lastRemaining = 0;
+    uint16_t overruns = 0;
+    bool dmaMode = false;
+    bool lineIdle = true;
 };
 #endif  /* C__USERS_JOSEL_DESKTOP_CPPLINT_REMOTECONTROL_H_*/
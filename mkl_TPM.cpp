@@ -39,6 +39,7 @@
  * @htmlonly    http://www.gnu.org/copyleft/gpl.html
  */
 #include "mkl_TPM.h"
+#include "mkl_TPMManager.h"
 
 /*!
  *   @fn         bindPeripheral
@@ -192,3 +193,65 @@ void mkl_TPM::setTPMParameters(tpm_Pin pin, uint8_t &pinNumber,
 void mkl_TPM::setBaseAddress (uint8_t TPMNumber, uint8_t **baseAddress) {
   *baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*TPMNumber);
 }
+
+/*!
+ *   @fn         TPMNumber
+ *
+ *   @brief      Nmero do TPM associado ao objeto.
+ *
+ *   Este mtodo obtm o nmero do TPM a partir do endereo do registrador
+ *   SC j associado ao objeto.
+ */
+uint8_t mkl_TPM::TPMNumber() {
+  return ((uint32_t)addressTPMxSC - TPM0_BASE) >> 12;
+}
+
+/*!
+ *   @fn         channelNumber
+ *
+ *   @brief      Nmero do canal associado ao objeto.
+ */
+uint8_t mkl_TPM::channelNumber() {
+  return ((uint32_t)addressTPMxCnSC - (uint32_t)addressTPMxSC - 0xC) >> 3;
+}
+
+/*!
+ *   @fn         shareCounter
+ *
+ *   @brief      Pede ao rbitro o contador do TPM em operao livre.
+ *
+ *   @param[in]  divBase - prescaler.
+ *               MODRegister - fundo de escala do contador.
+ *
+ *   @return     false se o TPM est em uso com outra configurao.
+ */
+bool mkl_TPM::shareCounter(tpm_Div divBase, uint16_t MODRegister) {
+  return mkl_TPMManager::shareCounter(TPMNumber(), divBase, MODRegister);
+}
+
+/*!
+ *   @fn         acquireChannel
+ *
+ *   @brief      Pede ao rbitro o canal do objeto.
+ */
+bool mkl_TPM::acquireChannel() {
+  return mkl_TPMManager::acquireChannel(TPMNumber(), channelNumber());
+}
+
+/*!
+ *   @fn         acquireExclusive
+ *
+ *   @brief      Pede ao rbitro o TPM inteiro para o objeto.
+ */
+bool mkl_TPM::acquireExclusive() {
+  return mkl_TPMManager::acquireExclusive(TPMNumber(), this);
+}
+
+/*!
+ *   @fn         releaseExclusive
+ *
+ *   @brief      Devolve ao rbitro o TPM reservado pelo objeto.
+ */
+void mkl_TPM::releaseExclusive() {
+  mkl_TPMManager::releaseExclusive(TPMNumber(), this);
+}
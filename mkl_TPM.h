@@ -179,6 +179,16 @@ class mkl_TPM {
                         uint8_t &TPMNumber, uint8_t &muxAltMask);
 
   void setBaseAddress (uint8_t TPMNumber, uint8_t **baseAddress);
+
+  /*!
+   * Mtodos de alocao no rbitro dos mdulos (mkl_TPMManager).
+   */
+  uint8_t TPMNumber();
+  uint8_t channelNumber();
+  bool shareCounter(tpm_Div divBase, uint16_t MODRegister);
+  bool acquireChannel();
+  bool acquireExclusive();
+  void releaseExclusive();
 };
 
 #endif  //  MKL_TPM_H_
@@ -55,10 +55,58 @@ mkl_TPMDelay::mkl_TPMDelay(tpm_TPMNumberMask tpmMask) {
   uint8_t *baseAddress;
   uint8_t tpm;
 
-  tpm = tpmMask << 11;
+  tpm = tpmMask >> 11;
   baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*tpm);
   bindPeripheral(baseAddress);
   enablePeripheralClock(tpm);
+  shared = false;
+  counterShared = false;
+  modulo = 0xFFFF;
+  start = 0;
+  length = 0;
+  refused = !acquireExclusive();
+}
+
+  /*!
+   *   @fn       mkl_TPMDelay
+   *
+   *   @brief    Mtodo construtor da classe no modo compartilhado.
+   *
+   *   O prescaler e o MOD so pedidos ao mkl_TPMManager em setFrequency.
+   *   Nenhum canal  usado: a temporizao l o contador.
+   *
+   *   @param[in]  tpm - perifrico TPM a ser associado ao objeto de software.
+   *               MODRegister - fundo de escala do contador compartilhado.
+   */
+mkl_TPMDelay::mkl_TPMDelay(tpm_TPMNumberMask tpmMask, uint16_t MODRegister) {
+  uint8_t *baseAddress;
+  uint8_t tpm;
+
+  tpm = tpmMask >> 11;
+  baseAddress = (uint8_t *)(TPM0_BASE + 0x1000*tpm);
+  bindPeripheral(baseAddress);
+  enablePeripheralClock(tpm);
+  shared = true;
+  counterShared = false;
+  modulo = MODRegister;
+  start = 0;
+  length = 0;
+  refused = true;
+}
+
+  /*!
+   *   @fn       ~mkl_TPMDelay
+   *
+   *   @brief    Mtodo destrutor da classe.
+   *
+   *   No modo exclusivo, para o contador e devolve o TPM ao rbitro.
+   */
+mkl_TPMDelay::~mkl_TPMDelay() {
+  if (shared || refused) {
+    return;
+  }
+  cancelDelay();
+  releaseExclusive();
 }
 
   /*!
@@ -71,6 +119,19 @@ mkl_TPMDelay::mkl_TPMDelay(tpm_TPMNumberMask tpmMask) {
    *   @param[in]  divBase - constante de diviso do divisor de frequncia.
    */
 void mkl_TPMDelay::setFrequency(tpm_Div divBase) {
+  if (shared) {
+    /*!
+     * Contador configurado pelo primeiro usurio do TPM.
+     */
+    if (!counterShared) {
+      counterShared = shareCounter(divBase, modulo);
+    }
+    refused = !counterShared;
+    return;
+  }
+  if (refused) {
+    return;
+  }
   cancelDelay();
   *addressTPMxSC = divBase;
 }
@@ -105,6 +166,17 @@ void mkl_TPMDelay::setFrequency(tpm_Div divBase) {
    *              65535  o fundo de escala do registrador TPMCNT.
    */
 void mkl_TPMDelay::startDelay(uint16_t cycles) {
+  if (refused) {
+    return;
+  }
+  if (shared) {
+    /*!
+     * Instante inicial; a durao  limitada a um perodo do contador.
+     */
+    start = *addressTPMxCNT;
+    length = (cycles > modulo) ? modulo : cycles;
+    return;
+  }
   /*!
   * Desabilita a contagem.
   */
@@ -137,6 +209,12 @@ void mkl_TPMDelay::startDelay(uint16_t cycles) {
    *   @param[in]  divBase - constante de diviso do divisor de frequncia.
    */
 int mkl_TPMDelay::timeoutDelay() {
+  if (refused) {
+    return 1;
+  }
+  if (shared) {
+    return (elapsed() >= length) ? 1 : 0;
+  }
   if (*addressTPMxSC & 0x80) {
     return 1;
   }
@@ -183,8 +261,17 @@ void mkl_TPMDelay::waitDelay(uint16_t cycles) {
    *   @brief    Cancela uma temporizao em andamento.
    *
    *   Mtodo que cancela uma temporizao iniciada, parando o contador.
+   *   No modo compartilhado o contador no  parado: a temporizao  dada
+   *   como encerrada.
    */
 void mkl_TPMDelay::cancelDelay() {
+  if (refused) {
+    return;
+  }
+  if (shared) {
+    length = 0;
+    return;
+  }
   /*!
   * Desabilita a contagem.
   */
@@ -196,11 +283,31 @@ void mkl_TPMDelay::cancelDelay() {
    *
    *   @brief    Mtodo que informa o valor atual da contagem.
    *
-   *   Mtodo que informa o valor atual do contador do temporizador.
+   *   Mtodo que informa o valor atual do contador do temporizador. No modo
+   *   compartilhado, informa as contagens desde o incio da temporizao.
    *
    *   @param[in]  value - varivel passada por referncia que ser atualizada
    *                       com o valor corrente do contador do temporizador.
    */
 void mkl_TPMDelay::getCounter(uint16_t *value) {
+  if (shared) {
+    *value = elapsed();
+    return;
+  }
   *value = *addressTPMxCNT;
 }
+
+  /*!
+   *   @fn       elapsed
+   *
+   *   @brief    Contagens desde o incio da temporizao no contador
+   *             compartilhado, que volta a zero depois de MOD.
+   */
+uint16_t mkl_TPMDelay::elapsed() {
+  uint16_t now = *addressTPMxCNT;
+
+  if (now >= start) {
+    return now - start;
+  }
+  return now + modulo + 1 - start;
+}
@@ -55,7 +55,24 @@
  *            implementa o modo de operao delay, podendo o usurio escolher
  *            entre um delay que "prende" e um delay que "no prende".
  *
+ *            Construdo s com o TPM, o objeto reconfigura SC, MOD e CNT a
+ *            cada temporizao e pede o mdulo exclusivo ao mkl_TPMManager;
+ *            se o mdulo j estiver em uso, as temporizaes terminam
+ *            imediatamente em vez de parar o contador de outro usurio.
  *
+ *            Construdo com o MOD, o objeto usa o contador compartilhado
+ *            do TPM, sem canal: a temporizao l o contador e compara as
+ *            contagens decorridas (mdulo MOD + 1) com a durao pedida,
+ *            limitada a um perodo do contador. O contador nunca 
+ *            parado, e o PWM ou a captura dos canais continuam em
+ *            operao.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Temporizao no TPM1 compartilhado com um tacmetro (50 Hz).
+ *              +fn mkl_TPMDelay delay(tpm_TPM1, 13106);
+ *              +fn delay.setFrequency(tpm_div32);
+ *              +fn delay.waitDelay(655);            // 1 ms
  */
 class mkl_TPMDelay : public mkl_TPM {
  public:
@@ -63,6 +80,8 @@ class mkl_TPMDelay : public mkl_TPM {
    * Construtor padro da classe.
    */
   explicit mkl_TPMDelay(tpm_TPMNumberMask pin);
+  mkl_TPMDelay(tpm_TPMNumberMask pin, uint16_t MODRegister);
+  ~mkl_TPMDelay();
   /*!
    * Mtodo de configurao da classe.
    */
@@ -84,6 +103,22 @@ class mkl_TPMDelay : public mkl_TPM {
    * Mtodo de cancelamento de temporizao.
    */
   void cancelDelay();
+
+ private:
+  /*!
+   * Atributos do modo compartilhado e da recusa do rbitro.
+   */
+  bool shared;
+  bool counterShared;
+  bool refused;
+  uint16_t start;
+  uint16_t length;
+  uint16_t modulo;
+
+  /*!
+   * Mtodo de leitura das contagens decorridas no modo compartilhado.
+   */
+  uint16_t elapsed();
 };
 
 #endif
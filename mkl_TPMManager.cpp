@@ -0,0 +1,203 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao da classe "mkl_TPMManager".
+ *
+ * @file        mkl_TPMManager.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_TPMManager.h"
+
+uint8_t mkl_TPMManager::mode[TPM_MODULES];
+uint8_t mkl_TPMManager::prescaler[TPM_MODULES];
+uint16_t mkl_TPMManager::modulo[TPM_MODULES];
+uint8_t mkl_TPMManager::channels[TPM_MODULES];
+const void *mkl_TPMManager::exclusiveOwner[TPM_MODULES];
+uint16_t mkl_TPMManager::refused;
+
+/*!
+ * Nmero de canais de cada mdulo.
+ */
+static const uint8_t channelCount[TPM_MODULES] = {6, 2, 2};
+
+/*!
+ *   @fn         shareCounter
+ *
+ *   @brief      Aloca o contador do mdulo em operao livre com o
+ *               prescaler e o MOD pedidos.
+ *
+ *   No primeiro pedido o contador  parado, configurado e reiniciado;
+ *   nos seguintes, com a mesma configurao, nada  escrito.
+ *
+ *   @param[in]  TPMNumber - nmero do TPM (0 a 2).
+ *               divBase - prescaler.
+ *               MODRegister - fundo de escala do contador.
+ *
+ *   @return     false se o mdulo est exclusivo ou com outra
+ *               configurao.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ *               - TPMxCNT: Counter Register. Pg.554.
+ *               - TPMxMOD: Modulo Register. Pg.554.
+ */
+bool mkl_TPMManager::shareCounter(uint8_t TPMNumber, tpm_Div divBase,
+                                  uint16_t MODRegister) {
+  volatile uint32_t *sc;
+
+  if (TPMNumber >= TPM_MODULES) {
+    return false;
+  }
+  if (mode[TPMNumber] == tpm_shared) {
+    if (prescaler[TPMNumber] == divBase && modulo[TPMNumber] == MODRegister) {
+      return true;
+    }
+    refused++;
+    return false;
+  }
+  if (mode[TPMNumber] == tpm_exclusive) {
+    refused++;
+    return false;
+  }
+
+  SIM_SCGC6 |= SIM_SCGC6_TPM0_MASK << TPMNumber;
+  SIM_SOPT2 |= SIM_SOPT2_TPMSRC(1);
+  sc = (volatile uint32_t *)(TPM0_BASE + 0x1000*TPMNumber);
+  *sc = 0;
+  *(sc + 1) = 0;                      // CNT
+  *(sc + 2) = MODRegister;            // MOD
+  *sc = divBase | 0x08;               // CMOD = 01: clock do mdulo
+  mode[TPMNumber] = tpm_shared;
+  prescaler[TPMNumber] = divBase;
+  modulo[TPMNumber] = MODRegister;
+  return true;
+}
+
+/*!
+ *   @fn         acquireExclusive
+ *
+ *   @brief      Reserva o mdulo inteiro para um nico usurio.
+ *
+ *   @param[in]  TPMNumber - nmero do TPM (0 a 2).
+ *               owner - identificao do usurio (o prprio objeto);
+ *               pedidos repetidos do mesmo dono so aceitos.
+ *
+ *   @return     false se o mdulo j est em uso por outro.
+ */
+bool mkl_TPMManager::acquireExclusive(uint8_t TPMNumber, const void *owner) {
+  if (TPMNumber >= TPM_MODULES) {
+    return false;
+  }
+  if (mode[TPMNumber] == tpm_unused
+      || (mode[TPMNumber] == tpm_exclusive
+          && exclusiveOwner[TPMNumber] == owner)) {
+    mode[TPMNumber] = tpm_exclusive;
+    exclusiveOwner[TPMNumber] = owner;
+    return true;
+  }
+  refused++;
+  return false;
+}
+
+/*!
+ *   @fn         releaseExclusive
+ *
+ *   @brief      Devolve o mdulo reservado por acquireExclusive.
+ *
+ *   S o dono libera o mdulo, que volta a livre. O contador no 
+ *   escrito: o dono o para antes, e o prximo usurio o reconfigura.
+ *
+ *   @param[in]  TPMNumber - nmero do TPM (0 a 2).
+ *               owner - o mesmo dono passado a acquireExclusive.
+ */
+void mkl_TPMManager::releaseExclusive(uint8_t TPMNumber, const void *owner) {
+  if (TPMNumber < TPM_MODULES && mode[TPMNumber] == tpm_exclusive
+      && exclusiveOwner[TPMNumber] == owner) {
+    mode[TPMNumber] = tpm_unused;
+    exclusiveOwner[TPMNumber] = 0;
+  }
+}
+
+/*!
+ *   @fn         acquireChannel
+ *
+ *   @brief      Aloca um canal de um mdulo compartilhado.
+ *
+ *   @return     false se o canal no existe, j est alocado ou o mdulo
+ *               no est compartilhado.
+ */
+bool mkl_TPMManager::acquireChannel(uint8_t TPMNumber, uint8_t chnNumber) {
+  if (TPMNumber >= TPM_MODULES || chnNumber >= channelCount[TPMNumber]
+      || mode[TPMNumber] != tpm_shared
+      || (channels[TPMNumber] & (1 << chnNumber))) {
+    refused++;
+    return false;
+  }
+  channels[TPMNumber] |= 1 << chnNumber;
+  return true;
+}
+
+/*!
+ *   @fn         releaseChannel
+ *
+ *   @brief      Libera o canal. O contador continua em operao.
+ */
+void mkl_TPMManager::releaseChannel(uint8_t TPMNumber, uint8_t chnNumber) {
+  if (TPMNumber < TPM_MODULES) {
+    channels[TPMNumber] &= ~(1 << chnNumber);
+  }
+}
+
+/*!
+ *   @fn         counterMode
+ *
+ *   @brief      Uso atual do contador do mdulo.
+ */
+tpm_CounterMode mkl_TPMManager::counterMode(uint8_t TPMNumber) {
+  if (TPMNumber >= TPM_MODULES) {
+    return tpm_unused;
+  }
+  return (tpm_CounterMode)mode[TPMNumber];
+}
+
+/*!
+ *   @fn         conflicts
+ *
+ *   @brief      Nmero de pedidos recusados desde o incio.
+ */
+uint16_t mkl_TPMManager::conflicts() {
+  return refused;
+}
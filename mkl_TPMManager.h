@@ -0,0 +1,122 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe "mkl_TPMManager".
+ *
+ * @file        mkl_TPMManager.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TPMMANAGER_H_
+#define MKL_TPMMANAGER_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPM.h"
+
+#define TPM_MODULES  3
+
+/*!
+ * Enum associado ao uso do contador de um mdulo TPM.
+ */
+typedef enum {
+  tpm_unused = 0,
+  tpm_shared,       // contador livre, prescaler e MOD fixos, vrios canais
+  tpm_exclusive     // um nico usurio reconfigura SC/MOD  vontade
+} tpm_CounterMode;
+
+/*!
+ *  @class    mkl_TPMManager.
+ *
+ *  @brief    rbitro dos mdulos TPM: dono do prescaler, do MOD e dos
+ *            canais de cada mdulo.
+ *
+ *  @details  O primeiro usurio de um mdulo define o prescaler e o MOD
+ *            e coloca o contador em operao, livre; os seguintes que
+ *            pedirem a mesma configurao compartilham o contador, cada
+ *            um com o seu canal (PWM, comparao para temporizao ou
+ *            captura), sem parar nem reiniciar o contador.
+ *
+ *            Pedidos incompatveis (outro prescaler ou MOD, canal j
+ *            alocado, mdulo exclusivo) so recusados e contados em
+ *            conflicts(), em vez de reconfigurar o mdulo de outro
+ *            usurio. Usurios que precisam reconfigurar SC/MOD (delay
+ *            clssico, portadora de IR) pedem o mdulo exclusivo e o
+ *            devolvem com releaseExclusive ao terminar, para que ele
+ *            possa voltar a ser compartilhado.
+ *
+ *            Os mtodos so chamados na configurao (construtores e
+ *            mtodos enable/start), no nas rotinas de interrupo;
+ *            a exceo  releaseExclusive, que o dono pode chamar no
+ *            fim da sua operao (s escreve o estado do prprio mdulo).
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Ventilador (PWM) e outro canal no mesmo TPM0.
+ *              +fn mkl_TPMManager::shareCounter(0, tpm_div16, 999);
+ *              +fn mkl_TPMManager::acquireChannel(0, 3);
+ */
+class mkl_TPMManager {
+ public:
+  /*!
+   * Mtodos de alocao do contador do mdulo.
+   */
+  static bool shareCounter(uint8_t TPMNumber, tpm_Div divBase,
+                           uint16_t MODRegister);
+  static bool acquireExclusive(uint8_t TPMNumber, const void *owner);
+  static void releaseExclusive(uint8_t TPMNumber, const void *owner);
+
+  /*!
+   * Mtodos de alocao dos canais.
+   */
+  static bool acquireChannel(uint8_t TPMNumber, uint8_t chnNumber);
+  static void releaseChannel(uint8_t TPMNumber, uint8_t chnNumber);
+
+  /*!
+   * Mtodos de consulta.
+   */
+  static tpm_CounterMode counterMode(uint8_t TPMNumber);
+  static uint16_t conflicts();
+
+ private:
+  static uint8_t mode[TPM_MODULES];
+  static uint8_t prescaler[TPM_MODULES];
+  static uint16_t modulo[TPM_MODULES];
+  static uint8_t channels[TPM_MODULES];
+  static const void *exclusiveOwner[TPM_MODULES];
+  static uint16_t refused;
+};
+
+#endif  //  MKL_TPMMANAGER_H_
@@ -71,9 +71,10 @@ mkl_TPMMeasure::mkl_TPMMeasure(tpm_Pin pin) {
   enablePeripheralClock(TPMNumber);
   enableGPIOClock(GPIONumber);
   selectMuxAlternative(muxAltMask);
+  channelAcquired = false;
 }
 mkl_TPMMeasure::mkl_TPMMeasure(){
-
+  channelAcquired = false;
 }
 
 /*!
@@ -128,6 +129,58 @@ void mkl_TPMMeasure::setEdge(tpm_Edge edge) {
   *addressTPMxCnSC = edge << 2;
 }
 
+/*!
+ *   @fn         setCaptureEdge.
+ *
+ *   @brief      Ajusta a borda de captura apenas do canal.
+ *
+ *   Diferente de "setEdge", no para o contador nem altera o mdulo, de
+ *   modo que pode ser usado em um canal de um TPM j em operao (vrios
+ *   canais compartilhando a mesma base de tempo). A interrupo e o DMA
+ *   do canal continuam como estavam.
+ *
+ *   @param[in]  edge - borda de operao.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+void mkl_TPMMeasure::setCaptureEdge(tpm_Edge edge) {
+  /*!
+   * Mantm CHIE e DMA; CHF  escrita com 0 para no descartar uma
+   * captura pendente.
+   */
+  *addressTPMxCnSC = (*addressTPMxCnSC & (0x40 | 0x01)) | (edge << 2);
+}
+
+/*!
+ *   @fn         startSharedCapture.
+ *
+ *   @brief      Inicia a captura no contador compartilhado do TPM.
+ *
+ *   O prescaler e o MOD so pedidos ao mkl_TPMManager: o primeiro usurio
+ *   do TPM configura e liga o contador, os demais precisam pedir a mesma
+ *   configurao. S o canal do objeto  configurado; pode ser chamado
+ *   de novo para trocar a borda.
+ *
+ *   @param[in]  divBase - fator de diviso.
+ *               edge - borda de captura.
+ *               MODRegister - fundo de escala (0xFFFF: contador livre).
+ *
+ *   @return     false se o TPM est em uso com outra configurao ou o
+ *               canal pertence a outro objeto (nada  escrito).
+ */
+bool mkl_TPMMeasure::startSharedCapture(tpm_Div divBase, tpm_Edge edge,
+                                        uint16_t MODRegister) {
+  if (!channelAcquired) {
+    if (!shareCounter(divBase, MODRegister) || !acquireChannel()) {
+      return false;
+    }
+    channelAcquired = true;
+  }
+  setCaptureEdge(edge);
+  return true;
+}
+
 /*!
  *   @fn         enableMeasure.
  *
@@ -243,3 +296,124 @@ int mkl_TPMMeasure::readData() {
 int mkl_TPMMeasure::getCounter() {
   return *addressTPMxCNT;
 }
+
+/*!
+ *   @fn         enableCaptureInterrupt.
+ *
+ *   @brief      Habilita a interrupo de captura do canal.
+ *
+ *   Cada borda detectada gera uma interrupo no vetor do TPM do canal
+ *   (TPMx_IRQHandler), onde o valor capturado deve ser lido com
+ *   "readCapture".
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ *               - NVIC: Nested Vectored Interrupt Controller. Pg. 51.
+ */
+void mkl_TPMMeasure::enableCaptureInterrupt() {
+  /*!
+   * Limpa a flag CHF pendente e habilita CHIE.
+   */
+  *addressTPMxCnSC |= 0x80 | 0x40;
+  NVIC_EnableIRQ((IRQn_Type)(TPM0_IRQn
+                 + (((uint32_t)addressTPMxSC - TPM0_BASE) >> 12)));
+}
+
+/*!
+ *   @fn         disableCaptureInterrupt.
+ *
+ *   @brief      Desabilita a interrupo de captura do canal.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+void mkl_TPMMeasure::disableCaptureInterrupt() {
+  /*!
+   * CHF  w1c:  retirada do valor escrito para no limpar uma captura
+   * pendente.
+   */
+  *addressTPMxCnSC &= ~(0x80 | 0x40);
+}
+
+/*!
+ *   @fn         isCaptureFlagSet.
+ *
+ *   @brief      Indica se o canal capturou uma borda ainda no lida.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+bool mkl_TPMMeasure::isCaptureFlagSet() {
+  return (*addressTPMxCnSC & 0x80) != 0;
+}
+
+/*!
+ *   @fn         readCapture.
+ *
+ *   @brief      L o valor do contador capturado na borda e limpa a flag.
+ *
+ *   @return     valor do registrador CnV no instante da borda.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnV: Channel Value Register. Pg. 557.
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+uint16_t mkl_TPMMeasure::readCapture() {
+  uint16_t value = *addressTPMxCnV;
+
+  *addressTPMxCnSC |= 0x80;
+  return value;
+}
+
+/*!
+ *   @fn         enableCaptureDMA.
+ *
+ *   @brief      Faz cada captura do canal gerar uma requisio de DMA.
+ *
+ *   Com CHIE e DMA ligados o canal no gera interrupo: a requisio 
+ *   enviada ao DMA, que l CnV e, ao ser atendida, limpa a flag CHF.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+void mkl_TPMMeasure::enableCaptureDMA() {
+  *addressTPMxCnSC |= 0x80 | 0x40 | 0x01;
+}
+
+/*!
+ *   @fn         disableCaptureDMA.
+ *
+ *   @brief      Desliga as requisies de DMA do canal.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ */
+void mkl_TPMMeasure::disableCaptureDMA() {
+  *addressTPMxCnSC &= ~(0x80 | 0x40 | 0x01);    // sem limpar CHF (w1c)
+}
+
+/*!
+ *   @fn         captureDMASource.
+ *
+ *   @brief      Nmero da fonte do DMAMUX associada ao canal deste TPM.
+ *
+ *   Calculado a partir dos endereos associados: os canais do TPM0 comeam
+ *   na fonte 24, os do TPM1 na 30 e os do TPM2 na 32.
+ */
+uint8_t mkl_TPMMeasure::captureDMASource() {
+  static const uint8_t firstSource[3] = {24, 30, 32};
+  uint32_t tpm = ((uint32_t)addressTPMxSC - TPM0_BASE) >> 12;
+  uint32_t channel = ((uint32_t)addressTPMxCnSC
+                      - (uint32_t)addressTPMxSC - 0xC) >> 3;
+
+  return firstSource[tpm] + channel;
+}
+
+/*!
+ *   @fn         captureRegister.
+ *
+ *   @brief      Endereo do registrador CnV, origem das transferncias.
+ */
+volatile uint32_t *mkl_TPMMeasure::captureRegister() {
+  return addressTPMxCnV;
+}
@@ -63,6 +63,22 @@
  *              +fn waitMeasure();
  *              +fn readData();
  *              +fn resetMeasure();
+ *
+ *            Uso dos mtodos para captura por interrupo.
+ *              +fn setEdge(tpm_both);
+ *              +fn enableCaptureInterrupt();
+ *              +fn readCapture();  // na rotina TPMx_IRQHandler
+ *
+ *            Uso dos mtodos para captura com o TPM compartilhado (o
+ *            contador no  parado nem reiniciado).
+ *              +fn startSharedCapture(tpm_div32, tpm_falling);
+ *              +fn enableCaptureInterrupt();
+ *
+ *            Uso dos mtodos para captura por DMA (sem interrupo).
+ *              +fn setEdge(tpm_both);
+ *              +fn dma.setRequestSource(captureDMASource());
+ *              +fn dma.setupRing16(captureRegister(), ring, size);
+ *              +fn enableCaptureDMA();
  */
 class mkl_TPMMeasure : public mkl_TPM {
  public:
@@ -77,6 +93,13 @@ class mkl_TPMMeasure : public mkl_TPM {
    */
   void setFrequency(tpm_Div divBase);
   void setEdge(tpm_Edge edge);
+  void setCaptureEdge(tpm_Edge edge);
+
+  /*!
+   * Mtodo de incio da captura em um contador compartilhado.
+   */
+  bool startSharedCapture(tpm_Div divBase, tpm_Edge edge,
+                          uint16_t MODRegister = 0xFFFF);
 
   /*!
    * Mtodos de habilitao de medio.
@@ -100,11 +123,32 @@ class mkl_TPMMeasure : public mkl_TPM {
   int readData();
   int getCounter();
 
+  /*!
+   * Mtodos de captura por interrupo.
+   */
+  void enableCaptureInterrupt();
+  void disableCaptureInterrupt();
+  bool isCaptureFlagSet();
+  uint16_t readCapture();
+
+  /*!
+   * Mtodos de captura por DMA.
+   */
+  void enableCaptureDMA();
+  void disableCaptureDMA();
+  uint8_t captureDMASource();
+  volatile uint32_t *captureRegister();
+
  private:
   /*!
    * Atributo de valor de medio realizada.
    */
   uint16_t measure;
+
+  /*!
+   * Canal j alocado no mkl_TPMManager.
+   */
+  bool channelAcquired;
 };
 
 #endif  //  MKL_TPMMEASURE_H_
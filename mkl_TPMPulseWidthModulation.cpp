@@ -132,6 +132,206 @@ void mkl_TPMPulseWidthModulation::setDutyCycle(uint16_t CnVRegister) {
   *addressTPMxCnV = CnVRegister;
 }
 
+/*!
+ *   @fn         startShared.
+ *
+ *   @brief      Inicia o PWM no contador compartilhado do TPM.
+ *
+ *   O prescaler e o MOD so pedidos ao mkl_TPMManager: o primeiro usurio
+ *   do TPM configura e liga o contador; os demais precisam pedir a mesma
+ *   configurao. O contador nunca  parado aqui e s o canal do objeto 
+ *   escrito, de modo que outros canais do mesmo TPM no so afetados.
+ *
+ *   @param[in]  divBase - fator de diviso.
+ *               MODRegister - valor do registrador TPMxMOD.
+ *               CnVRegister - duty cycle inicial.
+ *
+ *   @return     false se o TPM est em uso com outra configurao ou o
+ *               canal j foi alocado (nada  escrito).
+ */
+bool mkl_TPMPulseWidthModulation::startShared(tpm_Div divBase,
+                                              uint16_t MODRegister,
+                                              uint16_t CnVRegister) {
+  if (!shareCounter(divBase, MODRegister) || !acquireChannel()) {
+    return false;
+  }
+  *addressTPMxCnV = CnVRegister;
+  setPWMOperation();
+  return true;
+}
+
+/*!
+ *   @fn         updateDutyCycle.
+ *
+ *   @brief      Atualiza o duty cycle sem parar o contador.
+ *
+ *   Com o contador em operao no modo PWM alinhado  borda, o valor
+ *   escrito em CnV fica em buffer e s  copiado quando o contador passa
+ *   de MOD para zero: o perodo corrente termina com o duty cycle antigo
+ *   e o seguinte comea com o novo, sem pulso truncado. Com o contador
+ *   parado, a escrita tem efeito imediato.
+ *
+ *   @param[in]  CnVRegister - valor desejado para o registrador TPMxCnV.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxCnV: Channel Value Register. Pg. 557.
+ */
+void mkl_TPMPulseWidthModulation::updateDutyCycle(uint16_t CnVRegister) {
+  *addressTPMxCnV = CnVRegister;
+}
+
+/*!
+ *   @fn         updatePeriod.
+ *
+ *   @brief      Atualiza o perodo sem parar o contador.
+ *
+ *   Assim como CnV, o MOD escrito com o contador em operao s  copiado
+ *   na virada do contador. O prescaler no pode ser alterado desta forma
+ *   (exige o contador parado, ver setFrequency).
+ *
+ *   @param[in]  MODRegister - valor do registrador TPMxMOD.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxMOD: Modulo Register. Pg.554.
+ */
+void mkl_TPMPulseWidthModulation::updatePeriod(uint16_t MODRegister) {
+  *addressTPMxMOD = MODRegister;
+}
+
+/*!
+ *   @fn         updateDutyCycles.
+ *
+ *   @brief      Atualiza o duty cycle de vrios canais do mesmo TPM no
+ *               mesmo perodo.
+ *
+ *   As interrupes ficam mascaradas durante a espera da janela e as
+ *   escritas, para que todas sejam feitas antes da mesma virada do
+ *   contador.
+ *
+ *   @param[in]  channels - canais PWM, todos do mesmo TPM;
+ *               CnVRegisters - valores de CnV, um por canal;
+ *               count - nmero de canais.
+ *
+ *   @return     false se os canais no forem do mesmo TPM (nada  escrito).
+ */
+bool mkl_TPMPulseWidthModulation::updateDutyCycles(
+    mkl_TPMPulseWidthModulation *channels[], const uint16_t CnVRegisters[],
+    uint8_t count) {
+  uint32_t primask;
+  uint8_t i;
+
+  if (count == 0) {
+    return true;
+  }
+  for (i = 1; i < count; i++) {
+    if (channels[i]->addressTPMxSC != channels[0]->addressTPMxSC) {
+      return false;
+    }
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  channels[0]->waitUpdateWindow();
+  for (i = 0; i < count; i++) {
+    *channels[i]->addressTPMxCnV = CnVRegisters[i];
+  }
+  __set_PRIMASK(primask);
+  return true;
+}
+
+/*!
+ *   @fn         isRunning.
+ *
+ *   @brief      Verifica se o contador do TPM est em operao.
+ *
+ *   @return     true se o campo CMOD do registrador SC est habilitado.
+ */
+bool mkl_TPMPulseWidthModulation::isRunning() {
+  return (*addressTPMxSC & 0x18) != 0;
+}
+
+/*!
+ *   @fn         enableOverflowInterrupt.
+ *
+ *   @brief      Habilita a interrupo de estouro do contador.
+ *
+ *   A cada virada do contador (uma vez por perodo do PWM)  gerada uma
+ *   interrupo no vetor do TPM (TPMx_IRQHandler), que deve limpar a
+ *   flag com "clearOverflowFlag".  o instante em que os valores em
+ *   buffer so copiados, prprio para calcular o prximo duty cycle.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ *               - NVIC: Nested Vectored Interrupt Controller. Pg. 51.
+ */
+void mkl_TPMPulseWidthModulation::enableOverflowInterrupt() {
+  /*!
+   * Limpa a flag TOF pendente e habilita TOIE.
+   */
+  *addressTPMxSC |= 0x80 | 0x40;
+  NVIC_EnableIRQ((IRQn_Type)(TPM0_IRQn
+                 + (((uint32_t)addressTPMxSC - TPM0_BASE) >> 12)));
+}
+
+/*!
+ *   @fn         disableOverflowInterrupt.
+ *
+ *   @brief      Desabilita a interrupo de estouro do contador.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ */
+void mkl_TPMPulseWidthModulation::disableOverflowInterrupt() {
+  /*!
+   * TOF  limpa escrevendo 1:  mantida fora da mscara.
+   */
+  *addressTPMxSC = *addressTPMxSC & ~(0x80 | 0x40);
+}
+
+/*!
+ *   @fn         isOverflowFlagSet.
+ *
+ *   @brief      Verifica a flag de estouro TOF.
+ */
+bool mkl_TPMPulseWidthModulation::isOverflowFlagSet() {
+  return (*addressTPMxSC & 0x80) != 0;
+}
+
+/*!
+ *   @fn         clearOverflowFlag.
+ *
+ *   @brief      Limpa a flag de estouro TOF (escrita de 1).
+ */
+void mkl_TPMPulseWidthModulation::clearOverflowFlag() {
+  *addressTPMxSC |= 0x80;
+}
+
+/*!
+ *   @fn         waitUpdateWindow.
+ *
+ *   @brief      Aguarda at restarem mais de TPM_PWM_SYNC_CYCLES ciclos
+ *               antes da virada do contador.
+ *
+ *   A margem  convertida em contagens pelo prescaler (campo PS do
+ *   registrador SC). Se o contador j estiver fora da margem, retorna
+ *   sem esperar; caso contrrio espera a virada, no mximo a prpria
+ *   margem.
+ */
+void mkl_TPMPulseWidthModulation::waitUpdateWindow() {
+  uint32_t margin;
+  uint32_t mod;
+
+  if (!isRunning()) {
+    return;
+  }
+  margin = (TPM_PWM_SYNC_CYCLES >> (*addressTPMxSC & 0x07)) + 1;
+  mod = *addressTPMxMOD;
+  if (mod <= margin) {
+    return;                    // perodo menor que a margem: sem janela
+  }
+  while (*addressTPMxCNT + margin > mod) {}
+}
+
 /*!
  *   @fn         enableOperation.
  *
@@ -46,6 +46,12 @@
 #include <MKL25Z4.h>
 #include "mkl_TPM.h"
 
+/*!
+ * Ciclos reservados para escrever os CnV de uma atualizao sincronizada;
+ * convertidos em contagens do TPM conforme o prescaler.
+ */
+#define TPM_PWM_SYNC_CYCLES  128
+
 /*!
  *  @class    mkl_TPMPulseWidthModulation.
  *
@@ -55,6 +61,23 @@
  *            perifricos TPM0, TPM1 ou TPM2 e os pinos correspondentes e
  *            herdando da classe me "mkl_TPM".
  *
+ *            setFrequency e setDutyCycle param o contador e servem para a
+ *            configurao inicial. Com o PWM em operao, usa-se
+ *            updateDutyCycle/updatePeriod: o TPM mantm CnV e MOD em
+ *            buffer e s os copia quando o contador passa de MOD para
+ *            zero, de modo que o perodo corrente termina intacto e no
+ *            h pulso truncado.
+ *
+ *            startShared  a alternativa a setFrequency/enableOperation
+ *            quando o TPM  dividido com outros usurios (delay, captura):
+ *            o prescaler e o MOD so pedidos ao mkl_TPMManager, o contador
+ *            no  parado e s o canal do objeto  configurado.
+ *
+ *            updateDutyCycles escreve vrios canais do mesmo TPM no mesmo
+ *            perodo: se o contador estiver perto do fim do perodo, aguarda
+ *            a virada (no mximo TPM_PWM_SYNC_CYCLES ciclos) para que todos
+ *            os CnV sejam copiados na mesma virada.
+ *
  *  @section  EXAMPLES USAGE
  *
  *            Uso dos mtodos para gerao de sinal PWM.
@@ -62,6 +85,8 @@
  *              +fn setFrequency(tpm_div16, 999);
  *              +fn setDutyCycle(750);
  *              +fn enableOperation();
+ *              +fn updateDutyCycle(500);            // sem parar o contador
+ *              +fn enableOverflowInterrupt();       // TPMx_IRQHandler
  */
 class mkl_TPMPulseWidthModulation : public mkl_TPM {
  public:
@@ -76,6 +101,34 @@ class mkl_TPMPulseWidthModulation : public mkl_TPM {
   void setFrequency(tpm_Div divBase, uint16_t MODRegister);
   void setDutyCycle(uint16_t CnVRegister);
 
+  /*!
+   * Mtodo de incio do PWM em um contador compartilhado.
+   */
+  bool startShared(tpm_Div divBase, uint16_t MODRegister,
+                   uint16_t CnVRegister);
+
+  /*!
+   * Mtodos de atualizao com o PWM em operao (registradores em
+   * buffer, copiados na virada do contador).
+   */
+  void updateDutyCycle(uint16_t CnVRegister);
+  void updatePeriod(uint16_t MODRegister);
+  static bool updateDutyCycles(mkl_TPMPulseWidthModulation *channels[],
+                               const uint16_t CnVRegisters[], uint8_t count);
+
+  /*!
+   * Mtodo de verificao do contador em operao.
+   */
+  bool isRunning();
+
+  /*!
+   * Mtodos da interrupo de estouro do contador (uma por perodo).
+   */
+  void enableOverflowInterrupt();
+  void disableOverflowInterrupt();
+  bool isOverflowFlagSet();
+  void clearOverflowFlag();
+
   /*!
    * Mtodo de habilitar a operao PWM.
    */
@@ -91,6 +144,11 @@ class mkl_TPMPulseWidthModulation : public mkl_TPM {
    * Mtodo de seleo do modo de operao PWM.
    */
   void setPWMOperation();
+
+  /*!
+   * Mtodo de espera por uma janela segura antes da virada do contador.
+   */
+  void waitUpdateWindow();
 };
 
 #endif  //  MKL_TPMPulseWidthModulation_H_
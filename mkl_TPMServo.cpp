@@ -0,0 +1,239 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao da classe "mkl_TPMServo".
+ *
+ * @file        mkl_TPMServo.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_TPMServo.h"
+
+/*!
+ * Fim da fase: ida e volta pela tabela.
+ */
+#define SERVO_PHASE_END  ((uint32_t)2 * SERVO_PROFILE_POINTS << SERVO_PHASE_Q)
+
+/*!
+ *   @fn         mkl_TPMServo
+ *
+ *   @brief      Associa o objeto ao canal do TPM do pino do servo.
+ *
+ *   @param[in]  pin - pino do TPM ligado ao sinal do servo.
+ *               minPulseUs - pulso do ngulo 0, em us.
+ *               maxPulseUs - pulso de SERVO_ANGLE_MAX graus, em us.
+ */
+mkl_TPMServo::mkl_TPMServo(tpm_Pin pin, uint16_t minPulseUs,
+                           uint16_t maxPulseUs)
+    : mkl_TPMPulseWidthModulation(pin) {
+  this->minPulseUs = minPulseUs;
+  this->maxPulseUs = maxPulseUs;
+  minPulse = 0;
+  maxPulse = 0;
+  periodHz = 0;
+  enabled = false;
+  profile = profiles[0];
+  phase = 0;
+  step = 0;
+  current = 0;
+  sweeping = false;
+}
+
+/*!
+ *   @fn         enable
+ *
+ *   @brief      Inicia o PWM do servo no contador compartilhado do TPM.
+ *
+ *   Os limites do pulso so convertidos em contagens aqui, uma nica
+ *   vez. O servo parte em SERVO_ANGLE_MAX / 2 graus e a interrupo de
+ *   estouro  habilitada se ainda no estiver (outro usurio do TPM, como
+ *   o tacmetro, pode j t-la habilitado).
+ *
+ *   @param[in]  divBase - fator de diviso.
+ *               MODRegister - fundo de escala (perodo de 20 ms).
+ *
+ *   @return     false se o TPM est em uso com outra configurao.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ */
+bool mkl_TPMServo::enable(tpm_Div divBase, uint16_t MODRegister) {
+  uint32_t clockHz = SERVO_TPM_CLOCK_HZ >> divBase;
+
+  minPulse = (uint32_t)minPulseUs * (clockHz / 1000) / 1000;
+  maxPulse = (uint32_t)maxPulseUs * (clockHz / 1000) / 1000;
+  periodHz = clockHz / ((uint32_t)MODRegister + 1);
+  current = angleToCounts(SERVO_ANGLE_MAX / 2);
+  if (!startShared(divBase, MODRegister, current)) {
+    return false;
+  }
+  if (!(*addressTPMxSC & 0x40)) {
+    enableOverflowInterrupt();
+  }
+  enabled = true;
+  return true;
+}
+
+/*!
+ *   @fn         setAngle
+ *
+ *   @brief      Encerra a varredura e leva o servo ao ngulo indicado.
+ *
+ *   @param[in]  degrees - ngulo de 0 a SERVO_ANGLE_MAX.
+ */
+void mkl_TPMServo::setAngle(uint8_t degrees) {
+  sweeping = false;
+  current = angleToCounts(degrees);
+  if (enabled) {
+    updateDutyCycle(current);
+  }
+}
+
+/*!
+ *   @fn         sweep
+ *
+ *   @brief      Calcula a tabela de varredura e inicia o vai e vem.
+ *
+ *   A tabela tem SERVO_PROFILE_POINTS posies, de fromDegrees a
+ *   toDegrees, espaadas por 3t - 2t (t de 0 a 1 em Q10): o servo
+ *   desacelera perto das extremidades. O passo da fase, em Q16 pontos
+ *   por perodo do PWM,  tal que um sentido leva sweepMs.
+ *
+ *   @param[in]  fromDegrees - ngulo de uma extremidade.
+ *               toDegrees - ngulo da outra extremidade.
+ *               sweepMs - durao de um sentido, em ms.
+ */
+void mkl_TPMServo::sweep(uint8_t fromDegrees, uint8_t toDegrees,
+                         uint16_t sweepMs) {
+  uint16_t *table = (profile == profiles[0]) ? profiles[1] : profiles[0];
+  int32_t from = angleToCounts(fromDegrees);
+  int32_t span = (int32_t)angleToCounts(toDegrees) - from;
+  uint32_t periods;
+  uint32_t t;
+  uint32_t eased;
+  uint32_t primask;
+  uint16_t distance;
+  uint16_t nearest = 0xFFFF;
+  uint8_t start = 0;
+  uint8_t i;
+
+  for (i = 0; i < SERVO_PROFILE_POINTS; i++) {
+    t = (uint32_t)i * 1024 / (SERVO_PROFILE_POINTS - 1);
+    eased = (3 * t * t - 2 * t * t * t / 1024) / 1024;
+    table[i] = from + span * (int32_t)eased / 1024;
+    distance = (table[i] > current) ? table[i] - current : current - table[i];
+    if (distance < nearest) {
+      nearest = distance;
+      start = i;
+    }
+  }
+
+  periods = (uint32_t)sweepMs * periodHz / 1000;
+  if (periods == 0) {
+    periods = 1;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  profile = table;
+  phase = (uint32_t)start << SERVO_PHASE_Q;
+  step = ((uint32_t)SERVO_PROFILE_POINTS << SERVO_PHASE_Q) / periods;
+  if (step == 0) {
+    step = 1;
+  }
+  sweeping = true;
+  __set_PRIMASK(primask);
+}
+
+/*!
+ *   @fn         stopSweep
+ *
+ *   @brief      Encerra a varredura na posio em que est.
+ */
+void mkl_TPMServo::stopSweep() {
+  sweeping = false;
+}
+
+/*!
+ *   @fn         isSweeping
+ *
+ *   @brief      Verdadeiro durante a varredura.
+ */
+bool mkl_TPMServo::isSweeping() {
+  return sweeping;
+}
+
+/*!
+ *   @fn         handleOverflow
+ *
+ *   @brief      Avana a varredura um perodo do PWM.
+ *
+ *   Chamado na rotina TPMx_IRQHandler a cada estouro do contador, antes
+ *   de quem limpa a flag TOF (ou limpando-a, se o servo for o nico
+ *   usurio da interrupo). O CnV escrito entra em vigor na prxima
+ *   virada do contador.
+ */
+void mkl_TPMServo::handleOverflow() {
+  uint32_t p;
+  uint8_t i;
+
+  if (!sweeping) {
+    return;
+  }
+  p = phase + step;
+  if (p >= SERVO_PHASE_END) {
+    p -= SERVO_PHASE_END;
+  }
+  phase = p;
+  i = p >> SERVO_PHASE_Q;
+  if (i >= SERVO_PROFILE_POINTS) {
+    i = 2 * SERVO_PROFILE_POINTS - 1 - i;
+  }
+  current = profile[i];
+  updateDutyCycle(current);
+}
+
+/*!
+ *   @fn         angleToCounts
+ *
+ *   @brief      Converte o ngulo no CnV do pulso correspondente.
+ */
+uint16_t mkl_TPMServo::angleToCounts(uint8_t degrees) {
+  if (degrees > SERVO_ANGLE_MAX) {
+    degrees = SERVO_ANGLE_MAX;
+  }
+  return minPulse + (uint32_t)(maxPulse - minPulse) * degrees
+         / SERVO_ANGLE_MAX;
+}
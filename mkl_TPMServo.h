@@ -0,0 +1,137 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe "mkl_TPMServo".
+ *
+ * @file        mkl_TPMServo.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TPMSERVO_H_
+#define MKL_TPMSERVO_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPMPulseWidthModulation.h"
+
+/*!
+ * Clock do TPM (MCGFLLCLK), pontos do perfil de varredura (um sentido),
+ * ngulo mximo e formato da fase da varredura.
+ */
+#define SERVO_TPM_CLOCK_HZ     20971520
+#define SERVO_PROFILE_POINTS   32
+#define SERVO_ANGLE_MAX        180
+#define SERVO_PHASE_Q          16
+
+/*!
+ *  @class    mkl_TPMServo.
+ *
+ *  @brief    Servo motor (pulsos de 1 a 2 ms a 50 Hz) com varredura
+ *            automtica.
+ *
+ *  @details  O pulso  o PWM de um canal do TPM, com perodo de 20 ms
+ *            (div32 e MOD 13106 a 20,97 MHz). O contador  pedido ao
+ *            mkl_TPMManager e pode ser dividido com captura e
+ *            temporizao de outros usurios com a mesma base.
+ *
+ *            A varredura percorre uma tabela de CnV calculada uma nica
+ *            vez em sweep(): SERVO_PROFILE_POINTS posies entre os dois
+ *            ngulos, com acelerao e desacelerao nas extremidades
+ *            (3t - 2t). A cada estouro do contador, handleOverflow
+ *            avana uma fase em ponto fixo pelo passo da velocidade, vai
+ *            e volta pela tabela e escreve o CnV em buffer: uma soma,
+ *            uma comparao e uma escrita por perodo, sem diviso.
+ *
+ *            A tabela tem dois buffers: sweep() prepara o livre e troca
+ *            o ponteiro com as interrupes mascaradas, partindo do ponto
+ *            mais prximo da posio atual para no haver salto.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Aleta de 30 a 150 graus, 5 s por sentido.
+ *              +fn mkl_TPMServo servo(tpm_PTE21);
+ *              +fn servo.enable(tpm_div32, 13106);
+ *              +fn servo.sweep(30, 150, 5000);
+ *              +fn servo.handleOverflow();      // a cada estouro do TPM
+ *              +fn servo.setAngle(90);          // para na posio
+ */
+class mkl_TPMServo : public mkl_TPMPulseWidthModulation {
+ public:
+  /*!
+   * Mtodo construtor padro da classe.
+   */
+  explicit mkl_TPMServo(tpm_Pin pin = tpm_PTE21, uint16_t minPulseUs = 1000,
+                        uint16_t maxPulseUs = 2000);
+
+  /*!
+   * Mtodo de incio do PWM no contador compartilhado.
+   */
+  bool enable(tpm_Div divBase, uint16_t MODRegister);
+
+  /*!
+   * Mtodos de posio fixa e de varredura.
+   */
+  void setAngle(uint8_t degrees);
+  void sweep(uint8_t fromDegrees, uint8_t toDegrees, uint16_t sweepMs);
+  void stopSweep();
+  bool isSweeping();
+
+  /*!
+   * Mtodo de avano da varredura, chamado a cada estouro do contador.
+   */
+  void handleOverflow();
+
+ private:
+  uint16_t minPulseUs;
+  uint16_t maxPulseUs;
+  uint16_t minPulse;
+  uint16_t maxPulse;
+  uint16_t periodHz;
+  bool enabled;
+
+  uint16_t profiles[2][SERVO_PROFILE_POINTS];
+  const uint16_t *volatile profile;
+  volatile uint32_t phase;
+  volatile uint32_t step;
+  volatile uint16_t current;
+  volatile bool sweeping;
+
+  /*!
+   * Mtodo de converso de ngulo em contagens (CnV).
+   */
+  uint16_t angleToCounts(uint8_t degrees);
+};
+
+#endif  //  MKL_TPMSERVO_H_
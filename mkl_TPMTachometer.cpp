@@ -0,0 +1,198 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Implementao da classe "mkl_TPMTachometer".
+ *
+ * @file        mkl_TPMTachometer.cpp
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#include "mkl_TPMTachometer.h"
+
+/*!
+ *   @fn         mkl_TPMTachometer
+ *
+ *   @brief      Associa o objeto ao canal do TPM do pino do tacmetro.
+ *
+ *   @param[in]  pin - pino do TPM ligado ao tacmetro.
+ *               pulsesPerRevolution - pulsos do tacmetro por volta.
+ *               MODRegister - fundo de escala do contador compartilhado.
+ */
+mkl_TPMTachometer::mkl_TPMTachometer(tpm_Pin pin,
+                                     uint8_t pulsesPerRevolution,
+                                     uint16_t MODRegister)
+    : mkl_TPMMeasure(pin) {
+  this->pulsesPerRevolution = pulsesPerRevolution ? pulsesPerRevolution : 1;
+  counts = (uint32_t)MODRegister + 1;
+  halfCounts = counts / 2;
+  stallOverflows = (TACH_STALL_COUNTS + counts - 1) / counts;
+  overflows = 0;
+  lastEdge = 0;
+  period = 0;
+  edges = 0;
+  overflowsSinceEdge = 0;
+  stalled = true;
+}
+
+/*!
+ *   @fn         enable
+ *
+ *   @brief      Configura o canal no TPM compartilhado (div32, MOD do
+ *               construtor, borda de descida) e habilita as interrupes
+ *               de captura e de estouro.
+ *
+ *   O contador no  parado nem reiniciado: outros canais do mesmo TPM
+ *   (por exemplo a temporizao do DHT11) continuam em operao.
+ *
+ *   @return     false se o TPM est em uso com outra configurao.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ *               - PORTx_PCRn: Pin Control Register. Pg. 183.
+ */
+bool mkl_TPMTachometer::enable() {
+  *addressPortxPCRn |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+  if (!startSharedCapture(tpm_div32, tpm_falling, counts - 1)) {
+    return false;
+  }
+  restartStallTimer();
+  enableCaptureInterrupt();
+  /*!
+   * Limpa TOF e habilita TOIE.
+   */
+  *addressTPMxSC |= 0x80 | 0x40;
+  return true;
+}
+
+/*!
+ *   @fn         handleInterrupt
+ *
+ *   @brief      Trata a captura de borda e o estouro do contador.
+ *
+ *   @remarks    Sigla e pagina do Manual de Referencia KL25:
+ *               - TPMxSC: Status Control Register. Pg.552.
+ *               - TPMxCnSC: Channel Status and Control Register. Pg.555.
+ *               - TPMxCnV: Channel Value Register. Pg. 557.
+ */
+void mkl_TPMTachometer::handleInterrupt() {
+  uint32_t status = *addressTPMxSC;
+  uint32_t high = overflows;
+  uint32_t edge;
+  uint16_t capture;
+
+  if (*addressTPMxCnSC & 0x80) {
+    capture = *addressTPMxCnV;
+    *addressTPMxCnSC |= 0x80;
+    /*!
+     * Estouro pendente e captura no incio da contagem: a borda veio
+     * depois do estouro.
+     */
+    if ((status & 0x80) && capture < halfCounts) {
+      high++;
+    }
+    /*!
+     * Mdulo 2^32 a diferena entre dois instantes continua exata.
+     */
+    edge = high * counts + capture;
+    if (edges > 0) {
+      period = edge - lastEdge;
+      stalled = false;
+    } else {
+      edges = 1;
+    }
+    lastEdge = edge;
+    overflowsSinceEdge = 0;
+  }
+
+  if (status & 0x80) {
+    *addressTPMxSC |= 0x80;
+    overflows++;
+    if (overflowsSinceEdge < stallOverflows) {
+      overflowsSinceEdge++;
+    }
+    if (overflowsSinceEdge >= stallOverflows) {
+      stalled = true;
+      edges = 0;
+      period = 0;
+    }
+  }
+}
+
+/*!
+ *   @fn         readPeriod
+ *
+ *   @brief      Intervalo entre as duas ltimas bordas, em contagens de
+ *               TACH_CLOCK_HZ (0 se parado).
+ */
+uint32_t mkl_TPMTachometer::readPeriod() {
+  return period;
+}
+
+/*!
+ *   @fn         readRPM
+ *
+ *   @brief      Rotao em voltas por minuto (0 se parado).
+ */
+uint16_t mkl_TPMTachometer::readRPM() {
+  uint32_t ticks = period;
+
+  if (stalled || ticks == 0) {
+    return 0;
+  }
+  return (uint32_t)TACH_CLOCK_HZ * 60 / (ticks * pulsesPerRevolution);
+}
+
+/*!
+ *   @fn         isStalled
+ *
+ *   @brief      Verdadeiro se no houve bordas nos ltimos 0,9 s.
+ */
+bool mkl_TPMTachometer::isStalled() {
+  return stalled;
+}
+
+/*!
+ *   @fn         restartStallTimer
+ *
+ *   @brief      Reinicia a contagem de 0,9 s da deteco de parada, ao
+ *               acionar um ventilador parado: ele tem 0,9 s para gerar
+ *               bordas antes de ser considerado parado.
+ */
+void mkl_TPMTachometer::restartStallTimer() {
+  overflowsSinceEdge = 0;
+  edges = 0;
+  period = 0;
+  stalled = false;
+}
@@ -0,0 +1,138 @@
+/*!
+ * @copyright    2026 Universidade Federal do Amazonas.
+ *
+ * @brief       Interface da classe "mkl_TPMTachometer".
+ *
+ * @file        mkl_TPMTachometer.h
+ * @version     1.0
+ * @date        19 Outubro 2026
+ *
+ * @section     HARDWARES & SOFTWARES
+ *              +board        FRDM-KL25Z da NXP.
+ *              +processor    MKL25Z128VLK4 - ARM Cortex-M0+.
+ *              +compiler     Kinetis Design Studio IDE.
+ *              +manual       L25P80M48SF0RM, Rev.3, September 2012.
+ *              +revisions    Verso (data): Descrio breve.
+ *                             ++ 1.0 (19 Outubro 2026): Verso inicial.
+ *
+ * @section     AUTHORS & DEVELOPERS
+ *              +institution  Universidade Federal do Amazonas.
+ *              +courses      Engenharia da Computao / Engenharia Eltrica.
+ *              +teacher      Miguel Grimm <miguelgrimm@gmail.com>
+ *              +student      Verso inicial:
+ *                             ++ Felipe Santos
+ *
+ * @section     LICENSE
+ *
+ *              GNU General Public License (GNU GPL)
+ *
+ *              Este programa  um software livre; Voc pode redistribu-lo
+ *              e/ou modific-lo de acordo com os termos do "GNU General Public
+ *              License" como publicado pela Free Software Foundation; Seja a
+ *              verso 3 da licena, ou qualquer verso posterior.
+ *
+ *              Este programa  distribudo na esperana de que seja til,
+ *              mas SEM QUALQUER GARANTIA; Sem a garantia implcita de
+ *              COMERCIALIZAO OU USO PARA UM DETERMINADO PROPSITO.
+ *              Veja o site da "GNU General Public License" para mais detalhes.
+ *
+ * @htmlonly    http://www.gnu.org/copyleft/gpl.html
+ */
+
+#ifndef MKL_TPMTACHOMETER_H_
+#define MKL_TPMTACHOMETER_H_
+
+#include <stdint.h>
+#include <MKL25Z4.h>
+#include "mkl_TPMMeasure.h"
+
+/*!
+ * Base de tempo: 20,97 MHz / 32 = 655360 Hz (1,53 us por contagem); o
+ * contador estoura a cada MOD + 1 contagens (100 ms com MOD 0xFFFF).
+ */
+#define TACH_CLOCK_HZ          655360
+#define TACH_STALL_COUNTS      589824  // 0,9 s sem bordas: ventilador parado
+
+/*!
+ *  @class    mkl_TPMTachometer.
+ *
+ *  @brief    Mede a rotao de um ventilador pelo sinal do tacmetro.
+ *
+ *  @details  Cada borda de descida do tacmetro  capturada pelo canal
+ *            do TPM e tratada por interrupo (sem espera ativa). O
+ *            contador  estendido em software pela interrupo de estouro
+ *            (estouros * (MOD + 1) + captura): o instante de cada borda
+ *            tem 32 bits, de modo que
+ *            perodos maiores que um estouro (rotaes baixas) so medidos
+ *            corretamente.
+ *
+ *            Quando captura e estouro esto pendentes na mesma
+ *            interrupo, o valor capturado decide a ordem: abaixo da
+ *            metade do perodo do contador a borda ocorreu depois do
+ *            estouro, que ainda no foi contado.
+ *
+ *            Sem bordas por TACH_STALL_COUNTS contagens (0,9 s), o
+ *            ventilador  considerado parado e o perodo  descartado.
+ *            O pino recebe pull-up interno (sada coletor aberto do
+ *            tacmetro).
+ *
+ *            O contador do TPM  pedido ao mkl_TPMManager (div32 e o MOD
+ *            do construtor) e pode ser dividido com outros usurios da
+ *            mesma base, como o servo de 50 Hz (MOD 13106) e a
+ *            temporizao do DHT11; a interrupo de estouro  tratada
+ *            pelo tacmetro, que limpa a flag TOF.
+ *
+ *  @section  EXAMPLES USAGE
+ *
+ *            Tacmetro de 2 pulsos por volta no pino PTE20 (TPM1 CH0).
+ *              +fn mkl_TPMTachometer tach(tpm_PTE20, 2);
+ *              +fn tach.enable();
+ *              +fn tach.handleInterrupt();   // na rotina TPM1_IRQHandler
+ *              +fn tach.readRPM();
+ *              +fn tach.isStalled();
+ */
+class mkl_TPMTachometer : public mkl_TPMMeasure {
+ public:
+  /*!
+   * Mtodo construtor padro da classe.
+   */
+  explicit mkl_TPMTachometer(tpm_Pin pin = tpm_PTE20,
+                             uint8_t pulsesPerRevolution = 2,
+                             uint16_t MODRegister = 0xFFFF);
+
+  /*!
+   * Mtodo de incio da medio (captura e estouro por interrupo).
+   */
+  bool enable();
+
+  /*!
+   * Mtodo de tratamento, chamado na rotina TPMx_IRQHandler.
+   */
+  void handleInterrupt();
+
+  /*!
+   * Mtodos de leitura da medio.
+   */
+  uint32_t readPeriod();
+  uint16_t readRPM();
+  bool isStalled();
+
+  /*!
+   * Mtodo de reincio da deteco de parada (partida do ventilador).
+   */
+  void restartStallTimer();
+
+ private:
+  uint8_t pulsesPerRevolution;
+  uint32_t counts;
+  uint16_t halfCounts;
+  uint8_t stallOverflows;
+  volatile uint32_t overflows;
+  volatile uint32_t lastEdge;
+  volatile uint32_t period;
+  volatile uint8_t edges;
+  volatile uint8_t overflowsSinceEdge;
+  volatile bool stalled;
+};
+
+#endif  //  MKL_TPMTACHOMETER_H_